@@ -30,6 +30,7 @@
 #include <axlib/Timer.hpp>
 #include <axlib/axlib.hpp>
 
+#include "atLogStore.hpp"
 #include "editor/TextEditor.hpp"
 
 #include <fstream>
@@ -38,35 +39,101 @@
 namespace at {
 class Console : public ax::Window::Backbone {
 public:
-	Console(const ax::Rect& rect);
+	/// Number of lines kept before the oldest ones are dropped.
+	static const int DEFAULT_CAPACITY = 5000;
 
-	enum Events : ax::event::Id { WRITE_ERROR };
+	Console(const ax::Rect& rect, int capacity = DEFAULT_CAPACITY);
+
+	enum Events : ax::event::Id { WRITE_ERROR, FLUSH_LINES };
 
 	void Clear();
 
+	void SetCapacity(int capacity);
+
+	/// Show log store entries matching severity and source masks (see LogStore::Filter).
+	/// Shows the recent lines when no filter is set.
+	void SetFilter(int severity_mask, int source_mask, const std::string& text);
+
+	void ClearFilter();
+
+	bool IsFiltered() const
+	{
+		return _filter.active;
+	}
+
 private:
+	static const int LINE_HEIGHT = 15;
+
 	ax::Font _font;
 
 	struct MessageFormat {
-		MessageFormat(bool n, int t, const std::string& m)
-			: new_block(n)
+		MessageFormat()
+			: block_flip(false)
+			, type(0)
+		{
+		}
+
+		MessageFormat(bool b, int t, const std::string& m)
+			: block_flip(b)
 			, type(t)
 			, msg(m)
 		{
 		}
 
-		bool new_block;
+		// Block background is resolved on insert so dropping old lines doesn't flip colors.
+		bool block_flip;
 		int type;
 		std::string msg;
 	};
 
+	// Fixed capacity ring, _first_line is the index of the oldest line.
 	std::vector<MessageFormat> _lines;
+	std::size_t _first_line = 0;
+	std::size_t _n_lines = 0;
+	bool _block_flip = false;
+
+	// Filtered view over the log store, extended with new entries on flush.
+	struct Filter {
+		bool active = false;
+		int severity_mask = LogStore::ALL;
+		int source_mask = LogStore::ALL;
+		std::string text;
+		std::size_t n_checked = 0;
+		std::vector<std::size_t> indexes;
+	};
+
+	Filter _filter;
+
+	// Entries before this index were cleared.
+	std::size_t _log_start = 0;
+
+	// Lines added since last repaint are flushed once per burst.
+	bool _flush_pending = false;
+	int _first_shown_line = 0;
+
 	ax::Window* _panel;
-	ax::Window* _txt_panel;
 	ax::ScrollBar::Ptr _scrollBar;
 
+	const MessageFormat& GetLine(std::size_t index) const
+	{
+		return _lines[(_first_line + index) % _lines.size()];
+	}
+
+	void AddLines(const std::string& msg, int type);
+
+	int GetNumberOfRows() const
+	{
+		return _filter.active ? (int)_filter.indexes.size() : (int)_n_lines;
+	}
+
+	void UpdateFilter();
+
+	void UpdateScrollBar();
+
 	axEVENT_DECLARATION(ax::event::StringMsg, OnConsoleUpdate);
 	axEVENT_DECLARATION(ax::event::StringMsg, OnConsoleErrorUpdate);
+	axEVENT_DECLARATION(ax::event::EmptyMsg, OnFlushLines);
+	axEVENT_DECLARATION(ax::ScrollBar::Msg, OnScroll);
 
 	void OnMouseEnter(const ax::Point& pos);
 	void OnMouseLeave(const ax::Point& pos);
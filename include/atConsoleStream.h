@@ -10,10 +10,18 @@
 
 #include <axlib/axlib.hpp>
 
+#include "atLogStore.hpp"
+
+#include <atomic>
+#include <string>
+
 namespace at {
 class ConsoleStream : public ax::event::Object {
 public:
-	enum Events : ax::event::Id { WRITE_NEW_LINE, WRITE_ERROR };
+	enum Events : ax::event::Id { WRITE_NEW_LINE, WRITE_ERROR, DRAIN_QUEUE };
+
+	/// Messages waiting for the ui, producers drop messages past this count.
+	static const int MAX_PENDING_MESSAGES = 4096;
 
 	static inline ConsoleStream* GetInstance()
 	{
@@ -44,8 +52,16 @@ public:
 	//		}
 	//	}
 
-	void Write(const std::string& msg);
-	void Error(const std::string& err_msg);
+	/// Can be called from any thread, messages are delivered from the ui thread.
+	/// Doesn't wait on the ui thread but allocates, not for use in the audio callback.
+	void Write(const std::string& msg, LogStore::Source source = LogStore::SCRIPT);
+	void Error(const std::string& err_msg, LogStore::Source source = LogStore::SCRIPT);
+
+	/// Total number of messages dropped because the ui couldn't keep up.
+	std::size_t GetDroppedCount() const
+	{
+		return _total_dropped.load();
+	}
 
 	//	std::stringstream& GetStream()
 	//	{
@@ -82,6 +98,25 @@ public:
 
 private:
 	static std::unique_ptr<ConsoleStream> _instance;
+
+	struct Message {
+		Events type;
+		LogStore::Source source;
+		std::int64_t time;
+		std::string msg;
+		Message* next;
+	};
+
+	// Lock free multi producer stack, the ui thread takes the whole list at once.
+	std::atomic<Message*> _head;
+	std::atomic<int> _pending;
+	std::atomic<int> _dropped;
+	std::atomic<std::size_t> _total_dropped;
+	std::atomic<bool> _drain_scheduled;
+
+	void Push(Events type, LogStore::Source source, const std::string& msg);
+
+	void Drain();
 	//	std::stringstream _stream;
 
 	ConsoleStream();
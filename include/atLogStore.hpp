@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace at {
+/*
+ * Append only store of console messages.
+ * Message text is interned, entries only keep its id. Past SPILL_THRESHOLD entries are written to
+ * a temporary file which is memory mapped for reading, so only the recent entries stay in memory.
+ * Needs to be used from the ui thread.
+ */
+class LogStore {
+public:
+	enum Severity : std::uint8_t { INFO, WARNING, ERROR, NUMBER_OF_SEVERITIES };
+	enum Source : std::uint8_t { SCRIPT, AUDIO, MIDI, EDITOR, NUMBER_OF_SOURCES };
+
+	enum Mask { ALL = 0xFF };
+
+	struct Entry {
+		/// Milliseconds since epoch.
+		std::int64_t time;
+		std::uint32_t msg_id;
+		std::uint8_t severity;
+		std::uint8_t source;
+	};
+
+	static const std::size_t SPILL_THRESHOLD = 1 << 16;
+
+	static LogStore* GetInstance();
+
+	static std::int64_t GetTime();
+
+	~LogStore();
+
+	void Add(std::int64_t time, Severity severity, Source source, const std::string& msg);
+
+	std::size_t GetSize() const
+	{
+		return _n_spilled + _entries.size();
+	}
+
+	Entry GetEntry(std::size_t index) const;
+
+	const std::string& GetMessage(std::uint32_t msg_id) const
+	{
+		return *_messages[msg_id];
+	}
+
+	/// Append index of entries in [first, GetSize()[ matching masks (1 << severity, 1 << source)
+	/// and containing text (all if empty).
+	void Filter(int severity_mask, int source_mask, const std::string& text, std::size_t first,
+		std::vector<std::size_t>& indexes);
+
+private:
+	static std::unique_ptr<LogStore> _instance;
+
+	// Interned message text, _messages points to map keys.
+	std::unordered_map<std::string, std::uint32_t> _message_ids;
+	std::vector<const std::string*> _messages;
+
+	// Text search is done once per unique message, new messages are checked on next filter.
+	std::string _search_text;
+	std::vector<bool> _search_matches;
+
+	// Recent entries.
+	std::vector<Entry> _entries;
+
+	// Spilled entries.
+	int _spill_fd;
+	const Entry* _spill_map;
+	std::size_t _n_spilled;
+
+	LogStore();
+
+	void Spill();
+
+	void UpdateSearch(const std::string& text);
+};
+}
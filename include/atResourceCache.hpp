@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace at {
+/*
+ * Process wide cache of images and fonts shared by the editor and the widgets.
+ * Resources are keyed by path (and size for fonts) and handed out as shared handles, they stay in memory
+ * until ReleaseUnused is called while no handle is left outside of the cache.
+ * Png files can be decoded ahead of use on a worker thread (e.g. while the splash screen is shown),
+ * image and font objects are always created on the ui thread.
+ */
+class ResourceCache : public ax::event::Object {
+public:
+	enum Events : ax::event::Id { IMAGE_READY };
+
+	struct MemoryUsage {
+		std::size_t images = 0;
+		std::size_t fonts = 0;
+
+		/// Decoded pixels (rgba) of created images and of preloaded images not yet requested.
+		std::size_t image_bytes = 0;
+
+		/// Size of loaded font files.
+		std::size_t font_bytes = 0;
+	};
+
+	typedef std::function<void(const std::string& path)> ImageListener;
+
+	/// First call needs to be made from the ui thread (event connections and app event manager).
+	static ResourceCache* GetInstance();
+
+	~ResourceCache();
+
+	/// Image is loaded right away if it wasn't preloaded.
+	/// Needs to be called from the ui thread.
+	std::shared_ptr<ax::Image> GetImage(const std::string& path);
+
+	/// Returns nullptr until the image is decoded, decoding is queued on first call and IMAGE_READY
+	/// is pushed with the path once done. Needs to be called from the ui thread.
+	std::shared_ptr<ax::Image> GetImageAsync(const std::string& path);
+
+	/// Listener is called on the ui thread when an image requested with GetImageAsync is decoded.
+	/// Returns the id to remove it with (e.g. from the destructor of its owner).
+	int AddImageListener(ImageListener listener);
+
+	void RemoveImageListener(int id);
+
+	/// Queue png decoding on the worker thread.
+	void Preload(const std::vector<std::string>& paths);
+
+	/// Blocks until all queued images are decoded.
+	void WaitForPreload();
+
+	/// Number of preloaded images still waiting to be decoded.
+	std::size_t GetNumberOfPendingImages() const;
+
+	/// Font is shared between all users, its size should never be changed.
+	/// A size of zero keeps the font default size. Needs to be called from the ui thread.
+	std::shared_ptr<ax::Font> GetFont(const std::string& path, int size = 0);
+
+	/// Remove all resources without a handle outside of the cache (including preloaded pixels).
+	/// Needs to be called from the ui thread.
+	void ReleaseUnused();
+
+	/// Needs to be called from the ui thread.
+	MemoryUsage GetMemoryUsage() const;
+
+private:
+	struct Pixels {
+		bool valid;
+		ax::Size size;
+		std::vector<unsigned char> data;
+	};
+
+	struct FontEntry {
+		std::shared_ptr<ax::Font> font;
+		std::size_t bytes;
+	};
+
+	static std::unique_ptr<ResourceCache> _instance;
+
+	mutable std::mutex _mutex;
+	std::condition_variable _cond;
+	std::condition_variable _decoded_cond;
+
+	/// Front path is the one being decoded.
+	std::deque<std::string> _queue;
+	std::map<std::string, Pixels> _decoded;
+	std::thread _thread;
+	bool _running;
+
+	// Only accessed from the ui thread.
+	std::map<std::string, std::shared_ptr<ax::Image>> _images;
+	std::map<std::pair<std::string, int>, FontEntry> _fonts;
+	std::map<int, ImageListener> _image_listeners;
+	int _next_listener_id;
+
+	ResourceCache();
+
+	/// Needs to be called with _mutex locked.
+	void QueueDecoding(const std::string& path);
+
+	/// Creates image from decoded pixels, _mutex needs to be locked by lock.
+	std::shared_ptr<ax::Image> CreateImage(const std::string& path, std::unique_lock<std::mutex>& lock);
+
+	void DecodeThread();
+
+	void OnImageReady(ax::event::Msg* msg);
+
+	static bool DecodePng(const std::string& path, Pixels& pixels);
+};
+}
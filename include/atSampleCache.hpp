@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace at {
+/*
+ * Process wide cache of decoded samples keyed by content hash.
+ * Samples are shared between scripts, reloads and projects. Unreferenced samples stay in memory until
+ * the memory budget is exceeded and are then evicted in least recently used order.
+ */
+class SampleCache {
+public:
+	struct Sample {
+		std::string hash;
+		int channels;
+		int sample_rate;
+		std::size_t frames;
+
+		/// Interleaved PCM.
+		std::vector<float> data;
+	};
+
+	typedef std::shared_ptr<const Sample> Ptr;
+
+	static SampleCache* GetInstance();
+
+	/// Returns nullptr if file can't be read or decoded.
+	Ptr Load(const std::string& path);
+
+	/// Samples with a handle outside of the cache.
+	std::vector<Ptr> GetUsedSamples() const;
+
+private:
+	struct Entry {
+		std::shared_ptr<Sample> sample;
+		std::list<std::string>::iterator lru_it;
+	};
+
+	struct FileStamp {
+		std::time_t mtime;
+		std::uintmax_t size;
+		std::string hash;
+	};
+
+	/// Decoded PCM kept for unreferenced samples.
+	static const std::size_t MEMORY_BUDGET = 512 * 1024 * 1024;
+
+	static std::unique_ptr<SampleCache> _instance;
+
+	mutable std::mutex _mutex;
+	std::map<std::string, Entry> _entries;
+	std::map<std::string, FileStamp> _file_stamps;
+
+	/// Most recently used first.
+	std::list<std::string> _lru;
+
+	std::size_t _memory_usage;
+
+	SampleCache();
+
+	/// Needs to be called with _mutex locked.
+	Ptr Find(const std::string& hash);
+	Ptr Insert(const std::string& name, const std::string& hash, const std::vector<char>& content);
+	void Evict();
+
+	/// Forget file stamps of samples no longer in cache.
+	void PruneFileStamps();
+};
+}
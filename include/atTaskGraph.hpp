@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace at {
+/*
+ * Named tasks with dependencies run on a small pool of threads.
+ * A task starts as soon as all its dependencies are done, independent tasks run concurrently.
+ */
+class TaskGraph {
+public:
+	typedef std::size_t Id;
+
+	struct Task {
+		std::string name;
+		std::function<void()> fct;
+		std::vector<Id> dependencies;
+
+		/// Milliseconds from the beginning of Run.
+		double start_ms = 0.0;
+		double duration_ms = 0.0;
+	};
+
+	/// Called from the worker threads when a task starts (done is false) and when it is done.
+	typedef std::function<void(const Task& task, bool done, std::size_t n_done)> Observer;
+
+	/// Dependencies need to be added before the task depending on them.
+	Id Add(const std::string& name, std::function<void()> fct, const std::vector<Id>& dependencies = {});
+
+	/// Blocks until all tasks are done.
+	void Run(int n_threads, Observer observer = nullptr);
+
+	const std::vector<Task>& GetTasks() const
+	{
+		return _tasks;
+	}
+
+	/// Milliseconds taken by the last Run.
+	double GetTotalTime() const
+	{
+		return _total_ms;
+	}
+
+private:
+	std::vector<Task> _tasks;
+	double _total_ms = 0.0;
+};
+}
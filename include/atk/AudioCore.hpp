@@ -21,6 +21,9 @@ public:
 
 	~AudioCore();
 
+	/// Initialize PortAudio once (device scan), can be called from any thread ahead of InitAudio.
+	static PaError InitHost();
+
 	int InitAudio();
 	void StartAudio();
 	void StopAudio();
@@ -44,10 +44,13 @@ private:
 
 	std::shared_ptr<at::editor::MainWindow> CreateMainWindow();
 
+	void OpenProject(const std::string& project_path);
+
 	void OnPaint(ax::GC gc);
 
 	axEVENT_DECLARATION(ax::Button::Msg, OnCreateProject);
 	axEVENT_DECLARATION(ax::Button::Msg, OnOpenProject);
 	axEVENT_DECLARATION(ax::Button::Msg, OnDebugProject);
+	axEVENT_DECLARATION(ax::event::StringMsg, OnOpenRecentProject);
 };
 }
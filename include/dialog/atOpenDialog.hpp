@@ -25,8 +25,8 @@
 #ifndef __MDI_OPEN_DIALOG_H__
 #define __MDI_OPEN_DIALOG_H__
 
+#include "dialog/atProjectBrowser.hpp"
 #include <axlib/Button.hpp>
-#include <axlib/DropMenu.hpp>
 #include <axlib/axlib.hpp>
 
 namespace at {
@@ -45,11 +45,11 @@ namespace editor {
 		enum : ax::event::Id { OPEN, CANCEL };
 
 	private:
-		std::shared_ptr<ax::DropMenu> _menu;
+		std::shared_ptr<at::ProjectBrowser> _browser;
 
 		axEVENT_DECLARATION(ax::Button::Msg, OnOpen);
 		axEVENT_DECLARATION(ax::Button::Msg, OnCancel);
-		axEVENT_DECLARATION(ax::DropMenu::Msg, OnMenuSelection);
+		axEVENT_DECLARATION(ax::event::StringMsg, OnBrowserOpen);
 
 		void DeleteDialog();
 
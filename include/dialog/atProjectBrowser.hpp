@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include "project/atProjectIndex.hpp"
+#include <axlib/axlib.hpp>
+#include <map>
+
+namespace at {
+/*
+ * List of indexed projects or layouts.
+ * Only visible rows are drawn and thumbnails are loaded when their row is first shown.
+ */
+class ProjectBrowser : public ax::Window::Backbone {
+public:
+	enum : ax::event::Id { SELECT, OPEN };
+
+	ProjectBrowser(const ax::Rect& rect, const std::string& extension);
+
+	~ProjectBrowser();
+
+	/// Empty if nothing is selected.
+	std::string GetSelectedPath() const;
+
+private:
+	static const int ROW_HEIGHT = 34;
+
+	std::string _extension;
+	std::vector<ProjectIndex::Entry> _entries;
+	std::map<std::string, std::shared_ptr<ax::Image>> _thumbnails;
+	int _index_listener_id;
+	ax::Font _font;
+	ax::Font _font_info;
+	int _selected;
+	int _scroll_offset;
+
+	void UpdateEntries();
+	int GetRowIndex(const ax::Point& pos) const;
+
+	void OnMouseEnter(const ax::Point& pos);
+	void OnMouseLeave(const ax::Point& pos);
+	void OnScrollWheel(const ax::Point& delta);
+	void OnMouseLeftDown(const ax::Point& pos);
+	void OnMouseLeftDoubleClick(const ax::Point& pos);
+	void OnPaint(ax::GC gc);
+};
+}
@@ -40,10 +40,18 @@ namespace editor {
 
 		void SetSnap(bool active);
 
+		bool IsSmartGuideActive() const;
+
+		void SetSmartGuide(bool active);
+
 		void SetGridSpace(int space);
 
+		/// Closest grid intersection at or before pos (relative to grid window).
 		ax::Point FindClosestPosition(const ax::Point& pos) const;
 
+		/// Position of widget rect (relative to grid window) aligned on other widgets.
+		ax::Point FindGuidePosition(ax::Window* widget, const ax::Rect& rect) const;
+
 	private:
 		GridWindow* _gwin;
 	};
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Line based rope used by TextEditorLogic.
+ * Lines are stored in blocks of at most MAX_BLOCK_SIZE lines with the index of the first line of
+ * each block, so inserting or removing lines only moves lines of a single block.
+ */
+class TextBuffer {
+public:
+	static const std::size_t MAX_BLOCK_SIZE = 512;
+
+	/// Notified of every modification (e.g. syntax highlighter).
+	class Listener {
+	public:
+		virtual ~Listener()
+		{
+		}
+
+		virtual void OnLineChanged(std::size_t line) = 0;
+
+		virtual void OnLinesInserted(std::size_t index, std::size_t count) = 0;
+
+		virtual void OnLinesErased(std::size_t first, std::size_t last) = 0;
+	};
+
+	TextBuffer();
+
+	void SetLines(const std::vector<std::string>& lines);
+
+	void AddListener(Listener* listener)
+	{
+		_listeners.push_back(listener);
+	}
+
+	/// Whole document with a new line after each line.
+	/// The snapshot is shared until the next modification.
+	std::shared_ptr<const std::string> GetText() const;
+
+	std::size_t GetLineCount() const
+	{
+		return _n_lines;
+	}
+
+	std::size_t GetCharCount() const
+	{
+		return _n_chars;
+	}
+
+	const std::string& GetLine(std::size_t index) const;
+
+	int GetLineLength(std::size_t index) const
+	{
+		return (int)GetLine(index).size();
+	}
+
+	/// Insert text without new line in a line.
+	void Insert(std::size_t line, std::size_t x, const std::string& str);
+
+	/// Erase chars in a line.
+	void Erase(std::size_t line, std::size_t x, std::size_t n);
+
+	/// Append string at the end of a line.
+	void Append(std::size_t line, const std::string& str);
+
+	/// Split line at x, the right part becomes line + 1.
+	void SplitLine(std::size_t line, std::size_t x);
+
+	/// Append line + 1 to line and remove it.
+	void JoinLine(std::size_t line);
+
+	/// Insert lines before index (index == GetLineCount() appends).
+	void InsertLines(std::size_t index, const std::vector<std::string>& lines);
+
+	/// Remove lines [first, last).
+	void EraseLines(std::size_t first, std::size_t last);
+
+private:
+	typedef std::vector<std::string> Block;
+
+	std::vector<Block> _blocks;
+	std::vector<std::size_t> _block_start;
+	std::size_t _n_lines;
+	std::size_t _n_chars;
+	std::vector<Listener*> _listeners;
+
+	// Lines are mostly accessed sequentially (painting, cursor).
+	mutable std::size_t _last_block;
+	mutable std::shared_ptr<const std::string> _snapshot;
+
+	std::size_t FindBlock(std::size_t line) const;
+
+	std::string& GetMutableLine(std::size_t index);
+
+	void SplitBlock(std::size_t block);
+
+	void UpdateBlockStart(std::size_t block);
+
+	void Modified()
+	{
+		_snapshot.reset();
+	}
+};
@@ -28,11 +28,15 @@
 #include <axlib/Timer.hpp>
 #include <axlib/axlib.hpp>
 
+#include "editor/TextEditorCompletion.hpp"
+#include "editor/TextEditorHighlighter.hpp"
+#include "editor/TextEditorLinter.hpp"
 #include "editor/TextEditorLogic.hpp"
+#include <array>
 #include <fstream>
 #include <set>
 
-class TextEditor : public ax::Window::Backbone {
+class TextEditor : public ax::Window::Backbone, public TextBuffer::Listener {
 public:
 	class Info {
 	public:
@@ -74,18 +78,49 @@ public:
 
 	bool OpenFile(const std::string& path);
 
+	/// Select next match, pattern is only compiled when it changes.
+	bool Find(const std::string& pattern, bool regex = false);
+
+	bool Replace(const std::string& pattern, const std::string& replacement, bool regex = false);
+
+	int ReplaceAll(const std::string& pattern, const std::string& replacement, bool regex = false);
+
+	/// Last background compile check of the current content failed.
+	/// Returns false while content is being checked. Line is -1 if the error has no line.
+	bool HasSyntaxError(int& line, std::string& msg) const;
+
 private:
 	ax::Font _font;
 	ax::Font _line_num_font;
 	TextEditorLogic _logic;
+	TextEditorHighlighter _highlighter;
+	TextEditorLinter _linter;
 	Info _info;
 	ax::Window* _scrollPanel;
 	bool _find_cursor_position_x = false;
 
 	std::vector<std::vector<int>> _next_pos_data;
 
+	// Glyph advance of each char and x position of each char boundary of each line.
+	// Positions of a line are empty until needed and cleared when the line is modified.
+	std::array<int, 256> _char_advance;
+	std::vector<std::vector<int>> _line_positions;
+
 	std::set<std::string> _key_words_cpp;
 	std::set<std::string> _number_cpp;
+	ax::Color _token_colors[TextEditorHighlighter::NUMBER_OF_TOKEN_TYPES];
+
+	// Completion popup, buffer words follow every modification of the text.
+	static const int MAX_COMPLETIONS = 8;
+	static const int COMPLETION_WIDTH = 220;
+	static const char ESCAPE_KEY = 27;
+	TextEditorBufferWords _buffer_words;
+	std::vector<const SymbolTrie::Symbol*> _completions;
+	std::string _completion_prefix;
+	int _completion_index = 0;
+
+	// Enter only accepts a completion picked with up or down arrow.
+	bool _completion_picked = false;
 
 	int _line_height, _file_start_index;
 	int _n_line_shown;
@@ -98,13 +133,39 @@ private:
 
 	ax::Point GetPositionFromCursorIndex(const ax::Point& indexes);
 
+	int GetCharAdvance(char c);
+
+	/// Prefix sum of char advances, first position is 0.
+	const std::vector<int>& GetLinePositions(std::size_t line);
+
 	void MoveToCursorPosition();
 
+	bool SetSearchPattern(const std::string& pattern, bool regex);
+
+	void OnTextChanged();
+
+	std::string GetWordBeforeCursor() const;
+
+	void UpdateCompletion();
+
+	void CloseCompletion();
+
+	void AcceptCompletion();
+
+	void DrawCompletion(ax::GC& gc, const ax::Point& cursor_pos);
+
 	axEVENT_ACCESSOR(ax::ScrollBar::Msg, OnScroll);
 	void OnScroll(const ax::ScrollBar::Msg& msg);
 
 	void OnResize(const ax::Size& size);
 
+	// TextBuffer::Listener.
+	virtual void OnLineChanged(std::size_t line);
+
+	virtual void OnLinesInserted(std::size_t index, std::size_t count);
+
+	virtual void OnLinesErased(std::size_t first, std::size_t last);
+
 	// Keyboard events.
 	void OnLeftArrowDown(const char& key);
 
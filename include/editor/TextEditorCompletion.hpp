@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include "editor/TextBuffer.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Compressed prefix tree of completion symbols.
+ * Children are sorted so prefix lookups return symbols in alphabetical order.
+ */
+class SymbolTrie {
+public:
+	enum Kind { PYO_CLASS, PYO_METHOD, AX_WRAPPER, BUFFER_WORD };
+
+	struct Symbol {
+		std::string name;
+		Kind kind;
+		std::string brief;
+	};
+
+	SymbolTrie();
+
+	/// Words already in the trie are ignored.
+	void Insert(const std::string& word, Kind kind, const std::string& brief = "");
+
+	/// At most max_results symbols starting with prefix.
+	void Find(
+		const std::string& prefix, std::size_t max_results, std::vector<const Symbol*>& results) const;
+
+	void Clear();
+
+	const std::vector<Symbol>& GetSymbols() const
+	{
+		return _symbols;
+	}
+
+private:
+	struct Node {
+		std::string label;
+		int symbol;
+		std::vector<std::unique_ptr<Node>> children;
+	};
+
+	Node _root;
+	std::vector<Symbol> _symbols;
+
+	void Collect(const Node* node, std::size_t max_results, std::vector<const Symbol*>& results) const;
+};
+
+/*
+ * Identifiers of a TextBuffer offered as completions.
+ * Words are kept per line and only scanned again for modified lines, the trie is rebuilt from the
+ * word counts when a word appears or disappears.
+ */
+class TextEditorBufferWords : public TextBuffer::Listener {
+public:
+	TextEditorBufferWords();
+
+	/// Forget all lines, needs to be called when attached to a buffer.
+	void Reset(std::size_t n_lines);
+
+	/// At most max_results words starting with prefix, scanning modified lines first.
+	void Find(const TextBuffer& buffer, const std::string& prefix, std::size_t max_results,
+		std::vector<const SymbolTrie::Symbol*>& results);
+
+	// TextBuffer::Listener.
+	virtual void OnLineChanged(std::size_t line);
+
+	virtual void OnLinesInserted(std::size_t index, std::size_t count);
+
+	virtual void OnLinesErased(std::size_t first, std::size_t last);
+
+private:
+	struct Line {
+		bool valid;
+		std::vector<std::string> words;
+	};
+
+	std::vector<Line> _lines;
+	std::map<std::string, int> _word_count;
+	SymbolTrie _trie;
+	bool _trie_valid;
+
+	void Update(const TextBuffer& buffer);
+
+	void ForgetWords(Line& line);
+};
+
+/*
+ * Pyo classes and methods and ax wrapper symbols.
+ * Built once and saved to completion.index so pyo docs are never queried while typing.
+ * The index starts with its format version and a hash of the symbol lists, it is rebuilt when
+ * either changes.
+ */
+class TextEditorCompletion {
+public:
+	static TextEditorCompletion* GetInstance();
+
+	const SymbolTrie& GetSymbols() const
+	{
+		return _symbols;
+	}
+
+	/// Rebuild index from pyo docs.
+	void Rebuild();
+
+private:
+	static std::unique_ptr<TextEditorCompletion> _instance;
+
+	SymbolTrie _symbols;
+	std::string _index_path;
+
+	TextEditorCompletion();
+
+	static std::string GetInputHash();
+
+	bool Load();
+
+	bool Save();
+};
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include "editor/TextBuffer.hpp"
+
+#include <string>
+#include <vector>
+
+/*
+ * Incremental python tokenizer used by TextEditor.
+ * Tokens and lexer state at the end of each line are kept per line. After an edit, lines are lexed
+ * again from the modified line until the state at the beginning of a line is the same as before.
+ */
+class TextEditorHighlighter : public TextBuffer::Listener {
+public:
+	enum TokenType {
+		TEXT,
+		KEYWORD,
+		BUILTIN,
+		PYO_CLASS,
+		NUMBER,
+		STRING,
+		COMMENT,
+		OPERATOR,
+		DELIMITER,
+		NUMBER_OF_TOKEN_TYPES
+	};
+
+	enum LexerState { NORMAL, TRIPLE_SINGLE_QUOTE, TRIPLE_DOUBLE_QUOTE };
+
+	struct Token {
+		int begin;
+		int end;
+		TokenType type;
+	};
+
+	TextEditorHighlighter();
+
+	/// Forget all lines, needs to be called when attached to a buffer.
+	void Reset(std::size_t n_lines);
+
+	/// Tokens of a line, lexing modified lines above it first if needed.
+	const std::vector<Token>& GetTokens(const TextBuffer& buffer, std::size_t line);
+
+	/// Tokenize a single line starting in state, returns state at the end of line.
+	static LexerState LexLine(const std::string& text, LexerState state, std::vector<Token>& tokens);
+
+	static TokenType GetIdentifierType(const std::string& word);
+
+	// TextBuffer::Listener.
+	virtual void OnLineChanged(std::size_t line);
+
+	virtual void OnLinesInserted(std::size_t index, std::size_t count);
+
+	virtual void OnLinesErased(std::size_t first, std::size_t last);
+
+private:
+	struct Line {
+		bool valid;
+		LexerState in_state;
+		LexerState out_state;
+		std::vector<Token> tokens;
+	};
+
+	std::vector<Line> _lines;
+
+	// Lines before this index have valid tokens.
+	std::size_t _first_invalid;
+
+	void Update(const TextBuffer& buffer, std::size_t up_to);
+};
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+/*
+ * Undo history of TextEditorLogic.
+ * Only inserted and erased spans are stored, consecutive keystrokes are merged in a single entry.
+ */
+class TextEditorJournal {
+public:
+	static const std::size_t MAX_ENTRIES = 1000;
+	static const std::size_t MAX_BYTES = 4 * 1024 * 1024;
+
+	struct Edit {
+		enum Type { INSERT, ERASE };
+
+		Type type;
+		ax::Point pos;
+		std::string text;
+		ax::Point cursor_before;
+		ax::Point cursor_after;
+	};
+
+	/// Edits undone and redone together.
+	typedef std::vector<Edit> Entry;
+
+	TextEditorJournal();
+
+	/// Add an edit, merged with the last entry when it continues it or when merge is true.
+	void Record(const Edit& edit, bool merge = false);
+
+	/// Next recorded edit starts a new entry (e.g. cursor was moved).
+	void BreakMerging()
+	{
+		_can_merge = false;
+	}
+
+	/// Returns entry to revert in reverse order or nullptr.
+	const Entry* Undo();
+
+	/// Returns entry to apply again or nullptr.
+	const Entry* Redo();
+
+	void Clear();
+
+	/// Mark current state as saved.
+	void SetCheckpoint()
+	{
+		_checkpoint = (int)_index;
+		_can_merge = false;
+	}
+
+	/// True if text differs from the last checkpoint.
+	bool IsModified() const
+	{
+		return _checkpoint != (int)_index;
+	}
+
+	/// End position of text inserted at pos.
+	static ax::Point GetEndPosition(const ax::Point& pos, const std::string& text);
+
+private:
+	std::deque<Entry> _entries;
+
+	// Number of applied entries.
+	std::size_t _index;
+	std::size_t _bytes;
+	int _checkpoint;
+	bool _can_merge;
+
+	bool Merge(Edit& last, const Edit& edit) const;
+
+	static std::size_t GetEntrySize(const Entry& entry);
+};
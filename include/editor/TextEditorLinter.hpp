@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include "editor/TextBuffer.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+typedef struct _ts PyThreadState;
+
+/*
+ * Compiles the script in a background python interpreter once typing pauses.
+ * Only syntax errors are reported since the code is compiled without being executed.
+ */
+class TextEditorLinter : public ax::event::Object, public TextBuffer::Listener {
+public:
+	enum Events : ax::event::Id { DIAGNOSTIC_CHANGE, CHECK_REQUEST, CHECK_DONE };
+
+	/// Time without modification before the buffer is compiled.
+	static const int CHECK_DELAY_MS = 500;
+
+	struct Diagnostic {
+		bool valid = true;
+
+		/// Line index starting at 0, -1 if unknown.
+		int line = -1;
+		std::string msg;
+	};
+
+	TextEditorLinter(const TextBuffer& buffer);
+
+	~TextEditorLinter();
+
+	/// Result of the last check, only valid for the buffer content at the time it was compiled.
+	const Diagnostic& GetDiagnostic() const
+	{
+		return _diagnostic;
+	}
+
+	/// True when the diagnostic matches the current buffer content.
+	bool IsUpToDate() const
+	{
+		return _checked_generation == _generation;
+	}
+
+	// TextBuffer::Listener.
+	virtual void OnLineChanged(std::size_t line);
+
+	virtual void OnLinesInserted(std::size_t index, std::size_t count);
+
+	virtual void OnLinesErased(std::size_t first, std::size_t last);
+
+private:
+	const TextBuffer& _buffer;
+	PyThreadState* _interp;
+
+	// Ui thread state.
+	Diagnostic _diagnostic;
+	int _checked_generation;
+
+	// Shared with worker thread.
+	std::mutex _mutex;
+	std::condition_variable _cond;
+	bool _running;
+	int _generation;
+	int _requested_generation;
+	std::chrono::steady_clock::time_point _last_modification;
+	std::shared_ptr<const std::string> _text;
+	int _text_generation;
+	Diagnostic _result;
+	int _result_generation;
+
+	std::thread _thread;
+
+	void Touch();
+
+	void OnCheckRequest(ax::event::Msg* msg);
+
+	void OnCheckDone(ax::event::Msg* msg);
+
+	void CheckThread();
+};
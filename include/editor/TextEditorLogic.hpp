@@ -28,6 +28,10 @@
 #include <axlib/Timer.hpp>
 #include <axlib/axlib.hpp>
 
+#include "editor/TextBuffer.hpp"
+#include "editor/TextEditorJournal.hpp"
+#include "editor/TextEditorSearch.hpp"
+
 #include <fstream>
 #include <set>
 
@@ -45,9 +49,12 @@ public:
 
 	bool SaveFile(const std::string& file_path);
 
-	std::vector<std::string>& GetFileData();
+	const TextBuffer& GetFileData() const;
 
-	const std::vector<std::string>& GetFileData() const;
+	void AddBufferListener(TextBuffer::Listener* listener)
+	{
+		_file_data.AddListener(listener);
+	}
 
 	std::string GetFilePath() const;
 
@@ -65,15 +72,44 @@ public:
 
 	void AddChar(const char& c);
 
+	/// Insert text at cursor position, text can contain multiple lines.
+	void InsertText(const std::string& text);
+
 	void Enter();
 
 	void Delete();
 
 	void BackSpace();
 
+	/// Returns false when there is nothing to undo.
+	bool Undo();
+
+	/// Returns false when there is nothing to redo.
+	bool Redo();
+
+	TextEditorSearch& GetSearch()
+	{
+		return _search;
+	}
+
+	/// Select next match of search pattern after cursor.
+	bool FindNext();
+
+	/// Replace selected match and select the next one.
+	bool ReplaceNext(const std::string& replacement);
+
+	/// Replace all matches in a single undo step, returns number of replacements.
+	int ReplaceAll(const std::string& replacement);
+
+	/// True if text was modified since last open or save.
+	bool IsModified() const
+	{
+		return _journal.IsModified();
+	}
+
 	int GetLineLength(unsigned int index)
 	{
-		return _file_data[index].size();
+		return _file_data.GetLineLength(index);
 	}
 
 	bool IsSelected() const
@@ -104,11 +140,23 @@ public:
 
 	std::string GetSelectedContent() const;
 
+	std::string GetContent(const ax::Point& left, const ax::Point& right) const;
+
 private:
 	std::string _file_path;
 	ax::Point _cursor_pos;
 	SelectionRectangle _selection_rectangle;
-	std::vector<std::string> _file_data;
+	TextBuffer _file_data;
+	TextEditorJournal _journal;
+	TextEditorSearch _search;
 
 	void AssignSelectionPos(const ax::Point& pos);
+
+	// Recorded in journal, cursor moves at the end of the edit.
+	void InsertAt(const ax::Point& pos, const std::string& text, bool merge = false);
+	void EraseRange(const ax::Point& left, const ax::Point& right, bool merge = false);
+
+	// Not recorded.
+	void AddText(const ax::Point& pos, const std::string& text);
+	void RemoveText(const ax::Point& left, const ax::Point& right);
 };
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include "editor/TextBuffer.hpp"
+
+#include <regex>
+#include <string>
+#include <vector>
+
+/*
+ * Find and replace over a TextBuffer.
+ * Literal patterns use Boyer-Moore-Horspool, regex patterns std::regex (matches don't span lines).
+ * Matches are cached per line and only searched again for modified lines.
+ */
+class TextEditorSearch : public TextBuffer::Listener {
+public:
+	struct Match {
+		int begin;
+		int end;
+	};
+
+	TextEditorSearch();
+
+	/// Returns false if regex is invalid.
+	bool SetPattern(const std::string& pattern, bool regex = false, bool match_case = true);
+
+	void Clear();
+
+	bool IsActive() const
+	{
+		return !_pattern.empty();
+	}
+
+	const std::string& GetPattern() const
+	{
+		return _pattern;
+	}
+
+	const std::vector<Match>& GetLineMatches(const TextBuffer& buffer, std::size_t line);
+
+	/// First match starting at or after pos, search wraps around at the end of buffer.
+	bool FindNext(const TextBuffer& buffer, const ax::Point& pos, ax::Point& left, ax::Point& right);
+
+	/// Number of matches in the whole buffer.
+	std::size_t FindAll(const TextBuffer& buffer);
+
+	/// Replacement text of a match found in line, regex patterns can reference groups ($1).
+	std::string GetReplacement(
+		const std::string& line, const Match& match, const std::string& replacement) const;
+
+	// TextBuffer::Listener.
+	virtual void OnLineChanged(std::size_t line);
+
+	virtual void OnLinesInserted(std::size_t index, std::size_t count);
+
+	virtual void OnLinesErased(std::size_t first, std::size_t last);
+
+private:
+	struct Line {
+		bool valid;
+		std::vector<Match> matches;
+	};
+
+	std::string _pattern;
+	std::string _search_pattern;
+	bool _regex;
+	bool _match_case;
+	std::regex _re;
+	std::size_t _skip[256];
+	std::vector<Line> _lines;
+
+	void SearchLine(const std::string& text, std::vector<Match>& matches) const;
+
+	int FindLiteral(const std::string& text, std::size_t from) const;
+};
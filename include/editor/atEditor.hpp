@@ -56,6 +56,9 @@ namespace editor {
 
 		void SetupApplication();
 
+		/// Audio, python, midi and editor data loaded concurrently while the splash screen is shown.
+		static void RunStartupTasks(ax::event::Object& obj);
+
 		//		ax::event::Function _on_splash_open;
 
 		void OnSplashOpen(ax::event::Msg* msg);
@@ -29,6 +29,7 @@
 
 #include <axlib/Button.hpp>
 #include <axlib/ScrollBar.hpp>
+#include <axlib/TextBox.hpp>
 #include <axlib/Timer.hpp>
 
 #include "atConsole.h"
@@ -47,6 +48,9 @@ namespace editor {
 		void SaveFile(const std::string& path);
 		std::string GetScriptPath() const;
 
+		/// See TextEditor::HasSyntaxError.
+		bool HasScriptError(int& line, std::string& msg) const;
+
 	private:
 		// Resize elements.
 		ax::Point _delta_resize_click;
@@ -64,12 +68,32 @@ namespace editor {
 		TextEditor* _txt_editor;
 		Console* _console;
 
+		// Find and replace.
+		ax::Window* _find_bar;
+		ax::TextBox* _find_box;
+		ax::TextBox* _replace_box;
+
+		// Console filter.
+		ax::Window* _console_filter_bar;
+		ax::TextBox* _console_filter_box;
+		at::ColorButton* _console_errors_btn;
+
 		static const int MINIMUM_HEIGHT = 200;
 		static const int TOP_BAR_HEIGHT = 25;
+		static const int FIND_BAR_WIDTH = 390;
 
 		axEVENT_DECLARATION(ax::Button::Msg, OnTextEditor);
 		axEVENT_DECLARATION(ax::Button::Msg, OnConsole);
 		axEVENT_DECLARATION(ax::Button::Msg, OnConsoleClean);
+		axEVENT_DECLARATION(ax::Button::Msg, OnFind);
+		axEVENT_DECLARATION(ax::Button::Msg, OnReplace);
+		axEVENT_DECLARATION(ax::Button::Msg, OnReplaceAll);
+		axEVENT_DECLARATION(ax::Button::Msg, OnConsoleFilter);
+		axEVENT_DECLARATION(ax::Button::Msg, OnConsoleErrors);
+
+		void ApplyConsoleFilter();
+
+		void ShowConsole();
 
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnConsoleErrorUpdate);
 
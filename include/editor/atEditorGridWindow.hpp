@@ -27,6 +27,9 @@
 #include <axlib/DropMenu.hpp>
 #include <axlib/axlib.hpp>
 
+#include "editor/atEditorLayoutJournal.hpp"
+#include "editor/atEditorWidgetIndex.hpp"
+
 namespace at {
 namespace editor {
 	class GridSnapProxy;
@@ -58,7 +61,16 @@ namespace editor {
 
 			DELETE_SELECTED_WIDGET_FROM_RIGHT_CLICK,
 			DUPLICATE_SELECTED_WIDGET_FROM_RIGHT_CLICK,
-			SNAP_WIDGET_TO_GRID_FROM_RIGHT_CLICK
+			SNAP_WIDGET_TO_GRID_FROM_RIGHT_CLICK,
+			ALIGN_WIDGETS_FROM_RIGHT_CLICK,
+
+			// Selected widgets moved or resized by a GroupTransform.
+			WIDGETS_TRANSFORMED,
+
+			// Layout changed by undo or redo.
+			LAYOUT_UNDO_REDO,
+
+			REPAINT_DAMAGE
 		};
 
 		void SaveLayout(const std::string& path, const std::string& script_path);
@@ -78,21 +90,119 @@ namespace editor {
 		/// Set number of pixels between each grid lines.
 		void SetGridSpace(int space);
 
+		/// Widget index is rebuilt on next query (widgets added, removed or reparented).
+		void InvalidateWidgetIndex();
+
+		/// Update rect of a moved or resized widget and its children.
+		void UpdateWidgetIndex(ax::Window* widget);
+
+		/// Widgets intersecting rect (relative to grid window).
+		std::vector<ax::Window*> FindWidgets(const ax::Rect& rect);
+
+		/// Smallest widget containing pos (relative to grid window), nullptr if none.
+		ax::Window* FindWidget(const ax::Point& pos);
+
+		/// Closest grid intersection at or before pos (relative to grid window).
+		ax::Point FindClosestGridPosition(const ax::Point& pos) const;
+
+		/// Align edges or center of rect (relative to grid window) on the ones of other widgets.
+		/// Widget and its children are ignored. Returns the new rect position.
+		ax::Point FindGuidePosition(ax::Window* widget, const ax::Rect& rect);
+
+		/// Hide smart guide lines.
+		void ClearGuides();
+
+		/// Mark rect (relative to grid window) as needing a repaint. Damaged areas are merged and
+		/// repainted once on the next event loop turn, nothing is drawn if they are out of view.
+		void Invalidate(const ax::Rect& rect);
+
+		void InvalidateAll();
+
+		/// Undo history of layout edits, cleared when a layout is opened.
+		inline LayoutJournal& GetJournal()
+		{
+			return _journal;
+		}
+
+		/// Widgets are unselected before undoing, returns false if nothing to undo.
+		bool Undo();
+
+		bool Redo();
+
 	private:
+		/// Max distance in pixels for smart guides to snap.
+		static const int GUIDE_DISTANCE = 5;
+
+		struct GuideEdge {
+			int value;
+			ax::Window* widget;
+
+			bool operator<(const GuideEdge& edge) const
+			{
+				return value < edge.value;
+			}
+		};
+
 		int _grid_space;
 		std::pair<bool, ax::Rect> _selection;
 		ax::Color _bg_color;
 		bool _right_click_menu;
 		bool _draw_grid_over_children;
 		bool _is_snap_active = false;
+		bool _is_smart_guide_active = false;
 
+		// Grid lines of visible area, generated on paint.
 		std::vector<ax::FPoint> _horizontal_lines_array;
 		std::vector<ax::FPoint> _vertical_lines_array;
+		ax::Rect _lines_rect;
+		bool _lines_dirty = true;
+
+		// Sorted left, center and right (top, center and bottom) of all widgets.
+		std::vector<GuideEdge> _guide_x_edges;
+		std::vector<GuideEdge> _guide_y_edges;
+		ax::Window* _guide_widget = nullptr;
+
+		// Shown guide lines, -1 when none.
+		int _guide_x = -1;
+		int _guide_y = -1;
+
+		// Union of areas to repaint (relative to grid window).
+		ax::Rect _damage;
+		bool _has_damage = false;
+		bool _repaint_pending = false;
+
+		LayoutJournal _journal;
+
+		// Rects of all widgets relative to grid window.
+		WidgetIndex _widget_index;
+		bool _widget_index_dirty = true;
+
+		void RebuildWidgetIndex();
+
+		void RefreshAfterUndoRedo();
+
+		void AddToWidgetIndex(ax::Window* window, bool update);
+
+		/// Visible part of grid window (relative to grid window).
+		ax::Rect GetVisibleRect() const;
+
+		void UpdateGridLines();
+
+		void InvalidateGuides();
+
+		void InvalidateSelection();
+
+		void RebuildGuideEdges();
+
+		/// Closest edge to one of values, returns false if none within GUIDE_DISTANCE.
+		bool FindGuideEdge(const std::vector<GuideEdge>& edges, ax::Window* widget, const int values[3],
+			int& delta, int& edge) const;
 
 		axEVENT_DECLARATION(ax::event::SimpleMsg<PosAndWindow>, OnDropWidgetMenu);
 		axEVENT_DECLARATION(ax::DropMenu::Msg, OnMenuChoice);
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnWidgetIsDragging);
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnWidgetDoneDragging);
+		axEVENT_DECLARATION(ax::event::EmptyMsg, OnRepaintDamage);
 
 		void OnGlobalClick(const ax::Window::Event::GlobalClick& gclick);
 		void OnResize(const ax::Size& size);
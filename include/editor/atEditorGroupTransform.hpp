@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+namespace at {
+namespace editor {
+	class GridWindow;
+
+	/*
+	 * Move, scale, align or distribute a set of widgets in one pass.
+	 * New rects are computed on a copy and only applied on Commit, which updates the grid window
+	 * widget index once per widget and pushes a single WIDGETS_TRANSFORMED event.
+	 */
+	class GroupTransform {
+	public:
+		enum class Alignment { LEFT, HORIZONTAL_CENTER, RIGHT, TOP, VERTICAL_CENTER, BOTTOM };
+
+		enum class Distribution { HORIZONTAL, VERTICAL };
+
+		enum CommitFlags {
+			PUSH_EVENT = 1,
+			RECORD_UNDO = 2,
+			// Merge with last undo entry if it moved the same widgets (e.g. arrow moves).
+			MERGE_UNDO = 4
+		};
+
+		/// Widgets with an ancestor also in widgets are ignored since they move with it.
+		GroupTransform(GridWindow* grid, const std::vector<ax::Window*>& widgets);
+
+		void Translate(const ax::Point& delta);
+
+		/// Scale rects from the top left corner of the group bounding rect.
+		void Scale(double x_scale, double y_scale);
+
+		/// Align widgets on the bounding rect of the group.
+		void Align(Alignment alignment);
+
+		/// Space widgets evenly between the first and last one.
+		void Distribute(Distribution distribution);
+
+		/// Move each widget to the closest grid intersection.
+		void SnapToGrid();
+
+		/// Bounding rect of the group (relative to grid window).
+		ax::Rect GetBoundingRect() const;
+
+		/// Apply new rects.
+		void Commit(int flags = PUSH_EVENT | RECORD_UNDO);
+
+	private:
+		struct Entry {
+			ax::Window* widget;
+			ax::Rect old_rect;
+			ax::Rect rect;
+		};
+
+		GridWindow* _grid;
+
+		// Rects relative to grid window.
+		std::vector<Entry> _entries;
+	};
+}
+}
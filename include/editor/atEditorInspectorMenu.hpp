@@ -36,7 +36,7 @@ namespace editor {
 
 	private:
 		std::string _name;
-		ax::Font _font;
+		std::shared_ptr<ax::Font> _font;
 
 		void OnPaint(ax::GC gc);
 	};
@@ -52,8 +52,8 @@ namespace editor {
 
 	private:
 		ax::Window* _selected_handle;
-		ax::Font _font;
-		ax::Font _font_bold;
+		std::shared_ptr<ax::Font> _font;
+		std::shared_ptr<ax::Font> _font_bold;
 		bool _has_multiple_widget_selected;
 		bool _has_grid_window_connection = false;
 
@@ -64,6 +64,29 @@ namespace editor {
 			const std::string& name, const std::string& value, ax::event::Function fct)>;
 		std::map<ax::widget::ParamType, BuilderFct> _att_builder_map;
 
+		using SetterFct = std::function<void(ax::Window::Backbone* att, const std::string& value)>;
+		std::map<ax::widget::ParamType, SetterFct> _att_setter_map;
+
+		// Attribute editors kept between selections (hidden when not used).
+		struct PooledAttribute {
+			std::string name;
+			bool is_info;
+			ax::Window::Backbone* att;
+			bool is_used;
+		};
+
+		std::map<ax::widget::ParamType, std::vector<PooledAttribute>> _att_pool;
+		std::map<std::string, ax::Window*> _separators;
+
+		/// Reuse an unused pooled editor of same type and name or create a new one.
+		ax::Window::Backbone* AddAttribute(ax::widget::ParamType type, const ax::Rect& rect,
+			const std::string& name, const std::string& value, bool is_info);
+
+		void AddSeparator(const ax::Rect& rect, const std::string& name);
+
+		/// Show current position and size of selected widget.
+		void UpdateTransformAttributes();
+
 		using StrPairMsg = ax::event::SimpleMsg<std::pair<std::string, std::string>>;
 		axEVENT_DECLARATION(StrPairMsg, OnPyoCallback);
 		axEVENT_DECLARATION(StrPairMsg, OnWidgetUpdate);
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace at {
+namespace editor {
+	/*
+	 * Undo history of the layout editor.
+	 * Only deltas are stored : old and new rects of moved widgets, old and new values of edited
+	 * attributes and the detached windows of added or removed widgets (kept alive by the journal).
+	 */
+	class LayoutJournal {
+	public:
+		static const std::size_t MAX_ENTRIES = 200;
+
+		/// Merged edits need to follow each other within this delay (e.g. arrow nudges, number scroll).
+		static const int MERGE_DELAY_MS = 1000;
+
+		struct Edit {
+			enum Type { RECT, BUILDER_ATTRIBUTE, INFO_ATTRIBUTE, ADD, REMOVE };
+
+			Type type;
+			ax::Window* widget;
+
+			// RECT (relative to parent).
+			ax::Rect old_rect;
+			ax::Rect new_rect;
+
+			// BUILDER_ATTRIBUTE and INFO_ATTRIBUTE.
+			std::string name;
+			std::string old_value;
+			std::string new_value;
+
+			// ADD and REMOVE, index of window in parent children.
+			std::shared_ptr<ax::Window> window;
+			ax::Window* parent;
+			std::size_t index;
+		};
+
+		/// Edits undone and redone together.
+		typedef std::vector<Edit> Entry;
+
+		LayoutJournal();
+
+		/// Add an entry, merged with the last one when merge is true and it edits the same values.
+		void Record(Entry entry, bool merge = false);
+
+		/// Save rects of widgets before they get dragged or resized.
+		void BeginRectEdit(const std::vector<ax::Window*>& widgets);
+
+		/// Record widgets saved by BeginRectEdit which rect changed.
+		void EndRectEdit();
+
+		void RecordAttribute(ax::Window* widget, Edit::Type type, const std::string& name,
+			const std::string& old_value, const std::string& new_value);
+
+		/// Record a widget already added to its parent.
+		void RecordAdd(ax::Window* widget);
+
+		/// Record widgets already added to their parent in a single entry.
+		void RecordAdd(const std::vector<ax::Window*>& widgets);
+
+		/// Remove widgets from their parent, windows are kept for undo.
+		void RemoveWidgets(const std::vector<ax::Window*>& widgets);
+
+		/// Returns false if nothing to undo.
+		bool Undo();
+
+		/// Returns false if nothing to redo.
+		bool Redo();
+
+		void Clear();
+
+		/// Next recorded edit starts a new entry (e.g. selection changed, drag done).
+		void BreakMerging()
+		{
+			_can_merge = false;
+		}
+
+		bool CanUndo() const
+		{
+			return _index > 0;
+		}
+
+		bool CanRedo() const
+		{
+			return _index < _entries.size();
+		}
+
+		static Edit CreateRectEdit(ax::Window* widget, const ax::Rect& old_rect, const ax::Rect& new_rect);
+
+	private:
+		std::deque<Entry> _entries;
+
+		// Number of applied entries.
+		std::size_t _index;
+		bool _can_merge;
+		std::chrono::steady_clock::time_point _last_record;
+
+		// Rects saved by BeginRectEdit.
+		Entry _rect_edit;
+
+		bool Merge(Entry& last, const Entry& entry) const;
+
+		void Apply(Edit& edit, bool undo);
+
+		static void Attach(Edit& edit);
+
+		static void Detach(Edit& edit);
+	};
+}
+}
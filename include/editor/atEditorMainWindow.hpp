@@ -113,6 +113,8 @@ namespace editor {
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnRemoveWidgetFromRightClickMenu);
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnDuplicateWidgetFromRightClickMenu);
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnSnapToGridWidgetFromRightClickMenu);
+		axEVENT_DECLARATION(ax::event::StringMsg, OnAlignWidgetsFromRightClickMenu);
+		axEVENT_DECLARATION(ax::event::EmptyMsg, OnLayoutUndoRedo);
 
 		axEVENT_DECLARATION(ax::event::StringMsg, OnHelpBar);
 
@@ -5,22 +5,33 @@
 
 namespace at {
 namespace editor {
+	/*
+	 * One widget of the project tree (tree flattened in depth first order).
+	 */
+	struct ProjectSpaceRow {
+		ax::Window* widget;
+		int level;
+		std::string name;
+		std::string unique_name;
+		bool is_selected = false;
+	};
+
+	/*
+	 * Row window, only shown rows have one and they are reassigned when scrolling.
+	 */
 	class ProjectSpaceObj : public ax::Window::Backbone {
 	public:
-		ProjectSpaceObj(const ax::Rect& rect, const std::string& name, ax::Window* widget, int level);
+		ProjectSpaceObj(const ax::Rect& rect, ax::Font* font, ax::Font* font_bold);
 
-		void UnSelectAll();
-		void SetSelectedWidgets(const std::vector<ax::Window*>& widgets);
+		/// Row to draw, window is hidden when nullptr.
+		void SetRow(ProjectSpaceRow* row);
 
 	private:
-		ax::Font _font;
-		ax::Font _font_bold;
-		std::string _name;
-		ax::Window* _widget;
-		int _level;
-		std::string _unique_name;
-		bool _is_selected = false;
+		ax::Font* _font;
+		ax::Font* _font_bold;
+		ProjectSpaceRow* _row = nullptr;
 		std::shared_ptr<ax::Image> _icon;
+		std::string _icon_name;
 		ax::Color _icon_color;
 
 		void OnMouseLeftDoubleClick(const ax::Point& pos);
@@ -41,6 +52,8 @@ namespace editor {
 		axEVENT_DECLARATION(ax::event::EmptyMsg, OnWidgetAddedOrRemoved);
 
 	private:
+		static const int ROW_HEIGHT = 24;
+
 		ax::Font _font;
 		ax::Font _font_bold;
 		bool _has_objects = false;
@@ -49,6 +62,24 @@ namespace editor {
 		ax::ScrollBar* _scroll_bar;
 		bool _has_grid_window_connection = false;
 
+		std::vector<ProjectSpaceRow> _rows;
+		std::vector<ProjectSpaceObj*> _row_objs;
+		int _first_shown_row = 0;
+
+		void AddRows(ax::Window* widget, int level, std::vector<ProjectSpaceRow>& rows) const;
+
+		/// Assign rows to row windows, creating windows when panel got taller.
+		void UpdateRowObjs();
+
+		void UpdateScrollBar();
+
+		axEVENT_DECLARATION(ax::ScrollBar::Msg, OnScroll);
+
+		void OnMouseEnter(const ax::Point& pos);
+		void OnMouseEnterChild(const ax::Point& pos);
+		void OnMouseLeave(const ax::Point& pos);
+		void OnMouseLeaveChild(const ax::Point& pos);
+		void OnScrollWheel(const ax::Point& delta);
 		void OnResize(const ax::Size& size);
 		void OnPaint(ax::GC gc);
 	};
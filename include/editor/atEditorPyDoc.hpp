@@ -12,15 +12,30 @@
 #include "editor/atEditorPyDocSeparator.hpp"
 #include <axlib/ScrollBar.hpp>
 #include <axlib/axlib.hpp>
+#include <map>
 
 namespace at {
 namespace editor {
 
 	class PyDoc : public ax::Window::Backbone {
 	public:
+		typedef std::vector<std::pair<std::string, std::vector<std::string>>> ClassCategories;
+
 		PyDoc(const ax::Rect& rect);
 
+		/// Documented pyo classes by category.
+		static const ClassCategories& GetClassCategories();
+
+		/// Brief of pyo class documentation, queried once from pyo.
+		static std::string GetClassBrief(const std::string& name);
+
+		/// Query briefs of all documented classes ahead of use (e.g. from the loading thread).
+		/// Needs to be done before any PyDoc or text editor is created.
+		static void LoadClassBriefs();
+
 	private:
+		static std::map<std::string, std::string> _class_briefs;
+
 		std::vector<PyDocSeparator*> _separators;
 		ax::Window* _scroll_panel;
 		ax::ScrollBar::Ptr _scrollBar;
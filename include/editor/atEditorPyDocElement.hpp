@@ -19,8 +19,8 @@ namespace editor {
 		PyDocElement(const ax::Rect& rect, const std::string& name, const std::string& description);
 
 	private:
-		ax::Font _font;
-		ax::Font _font_normal;
+		std::shared_ptr<ax::Font> _font;
+		std::shared_ptr<ax::Font> _font_normal;
 		std::string _name;
 		std::string _description;
 		std::vector<std::string> _desc_content;
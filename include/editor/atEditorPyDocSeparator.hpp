@@ -24,7 +24,7 @@ namespace editor {
 		enum Events : ax::event::Id { NEED_RESIZE };
 
 	private:
-		ax::Font _font;
+		std::shared_ptr<ax::Font> _font;
 		std::string _name;
 		std::string _description;
 		std::vector<std::string> _desc_content;
@@ -75,6 +75,7 @@ namespace editor {
 		ColorButton* _view_app_btn;
 		ColorButton* _play_btn;
 		ColorButton* _snap_btn;
+		ColorButton* _guide_btn;
 		ax::NumberScroll* _grid_space_scroll;
 		std::string _layout_file_path;
 		//		at::MidiFeedback* _midi_feedback;
@@ -90,6 +91,7 @@ namespace editor {
 
 		axEVENT_DECLARATION(ax::NumberScroll::Msg, OnGridSpace);
 		axEVENT_DECLARATION(ax::Button::Msg, OnSnapToGrid);
+		axEVENT_DECLARATION(ax::Button::Msg, OnSmartGuide);
 		axEVENT_DECLARATION(ax::Toggle::Msg, OnToggleLeftPanel);
 		axEVENT_DECLARATION(ax::Toggle::Msg, OnToggleBottomPanel);
 		axEVENT_DECLARATION(ax::Toggle::Msg, OnToggleRightPanel);
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace at {
+namespace editor {
+	/*
+	 * Attributes of widget description files (widgets/ and custom_widgets/) keyed by path and mtime.
+	 * Persisted between runs so unchanged files are never parsed again.
+	 */
+	class WidgetDescriptorCache {
+	public:
+		typedef std::map<std::string, std::string> Descriptor;
+
+		static WidgetDescriptorCache* GetInstance();
+
+		/// Attributes of the first node_name node of xml file.
+		/// Returns false if file can't be parsed or is missing node or attributes.
+		bool GetDescriptor(const std::string& path, const std::string& node_name,
+			const std::vector<std::string>& attributes, Descriptor& descriptor);
+
+		/// Writes cache file if anything changed.
+		bool Save();
+
+	private:
+		struct Entry {
+			std::time_t mtime;
+			std::string node_name;
+			bool valid;
+			Descriptor values;
+		};
+
+		static std::unique_ptr<WidgetDescriptorCache> _instance;
+
+		std::string _cache_path;
+		std::map<std::string, Entry> _entries;
+		bool _modified;
+
+		WidgetDescriptorCache();
+
+		bool Load();
+
+		static Entry ParseFile(const std::string& path, std::time_t mtime, const std::string& node_name,
+			const std::vector<std::string>& attributes);
+	};
+}
+}
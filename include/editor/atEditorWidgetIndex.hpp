@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace at {
+namespace editor {
+	/*
+	 * Quadtree of widget rectangles.
+	 * Widgets are stored in the smallest node fully containing them, widgets outside of the bounds
+	 * stay in the root node. Queries only visit nodes intersecting the searched area.
+	 */
+	class WidgetIndex {
+	public:
+		WidgetIndex();
+
+		/// Remove all widgets and set area covered by the tree.
+		void Clear(const ax::Rect& bounds);
+
+		void Insert(ax::Window* widget, const ax::Rect& rect);
+
+		bool Remove(ax::Window* widget);
+
+		/// Move widget to new rect, inserted if not already in index.
+		void Update(ax::Window* widget, const ax::Rect& rect);
+
+		bool GetRect(ax::Window* widget, ax::Rect& rect) const;
+
+		/// All indexed widgets (in no particular order).
+		void GetWidgets(std::vector<ax::Window*>& widgets) const;
+
+		/// Widgets with a rect intersecting rect.
+		void FindIntersecting(const ax::Rect& rect, std::vector<ax::Window*>& widgets) const;
+
+		/// Widgets with a rect containing pos.
+		void FindContaining(const ax::Point& pos, std::vector<ax::Window*>& widgets) const;
+
+		std::size_t GetSize() const
+		{
+			return _nodes.size();
+		}
+
+		static bool Intersects(const ax::Rect& a, const ax::Rect& b);
+
+		static bool Contains(const ax::Rect& outer, const ax::Rect& inner);
+
+	private:
+		static const int MAX_DEPTH = 8;
+		static const std::size_t NODE_CAPACITY = 8;
+
+		struct Item {
+			ax::Window* widget;
+			ax::Rect rect;
+		};
+
+		struct Node {
+			ax::Rect bounds;
+			int depth;
+			std::vector<Item> items;
+			std::unique_ptr<Node> children[4];
+		};
+
+		Node _root;
+
+		// Node holding each widget.
+		std::unordered_map<ax::Window*, Node*> _nodes;
+
+		void Insert(Node* node, const Item& item);
+
+		void Split(Node* node);
+
+		void FindIntersecting(
+			const Node* node, const ax::Rect& rect, std::vector<ax::Window*>& widgets) const;
+	};
+}
+}
@@ -39,6 +39,8 @@ namespace editor {
 	public:
 		WidgetMenu(const ax::Rect& rect);
 
+		~WidgetMenu();
+
 		enum : ax::event::Id { SMALLER_MENU };
 
 		void SetOnlyMainWindowWidgetSelectable();
@@ -48,12 +50,15 @@ namespace editor {
 
 		void SetWide();
 
+		/// Widgets of widgets/ directory, Panel first.
+		static std::vector<WidgetMenuInfo> GetWidgetsInfo();
+
 	private:
 		ax::Window* _panel;
 		ax::ScrollBar::Ptr _scrollBar;
 		std::vector<std::shared_ptr<WidgetMenuObj>> _objs;
+		int _image_listener_id;
 
-		std::vector<WidgetMenuInfo> GetWidgetsInfo();
 		//		std::vector<std::string> GetBuilderList(const std::vector<WidgetMenuInfo>& w_info);
 
 		void OnMouseEnter(const ax::Point& pos);
@@ -34,8 +34,8 @@ namespace editor {
 		void SetSelectable(bool selectable);
 
 	private:
-		ax::Font _font;
-		ax::Font _font_normal;
+		std::shared_ptr<ax::Font> _font;
+		std::shared_ptr<ax::Font> _font_normal;
 		WidgetMenuInfo _info;
 		//		std::string _builder_name, _file_path,_title, _info, _size_str;
 		std::shared_ptr<ax::Image> _img;
@@ -18,7 +18,7 @@ namespace editor {
 		WidgetMenuSeparator(const ax::Rect& rect, const std::string& name);
 
 	private:
-		ax::Font _font;
+		std::shared_ptr<ax::Font> _font;
 		std::string _name;
 
 		void OnMouseLeftDown(const ax::Point& pos);
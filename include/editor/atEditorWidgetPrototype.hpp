@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <axlib/axlib.hpp>
+
+#include <ctime>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace at {
+namespace editor {
+	class Loader;
+
+	/*
+	 * Copy of widget trees with their editor components (pyo function, unique and class names,
+	 * window events) that can be cloned many times without going through xml.
+	 */
+	class WidgetPrototype {
+	public:
+		/// Widgets with an ancestor also in widgets are copied with it.
+		WidgetPrototype(const std::vector<ax::Window*>& widgets);
+
+		/// Copied widgets, only valid while they exist.
+		inline const std::vector<ax::Window*>& GetSourceWidgets() const
+		{
+			return _sources;
+		}
+
+		/// New widget trees (same order as source widgets), not added to any parent.
+		/// Unique names are changed to be unique in grid window.
+		/// When setup_roots is false, top level widgets are not setup for editing.
+		std::vector<std::shared_ptr<ax::Window::Backbone>> Clone(bool setup_roots = true) const;
+
+		/// Prototype of a custom widget file, nullptr if not cached or file changed.
+		static std::shared_ptr<WidgetPrototype> GetCustomWidget(const std::string& path);
+
+		static void AddCustomWidget(const std::string& path, std::shared_ptr<WidgetPrototype> prototype);
+
+	private:
+		struct Node {
+			std::shared_ptr<ax::Window::Backbone> backbone;
+			ax::Point position;
+			std::string builder_name;
+			std::string pyo_fct;
+			std::string unique_name;
+			std::string class_name;
+			std::vector<std::pair<std::string, std::string>> window_events;
+			std::vector<Node> children;
+		};
+
+		struct CacheEntry {
+			std::time_t mtime;
+			std::shared_ptr<WidgetPrototype> prototype;
+		};
+
+		std::vector<Node> _roots;
+		std::vector<ax::Window*> _sources;
+
+		static std::map<std::string, CacheEntry> _custom_widgets;
+
+		static Node CreateNode(ax::Window* widget);
+
+		std::shared_ptr<ax::Window::Backbone> CloneNode(
+			const Node& node, Loader& loader, std::set<std::string>& names, bool setup) const;
+	};
+}
+}
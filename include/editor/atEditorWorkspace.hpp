@@ -20,6 +20,8 @@ namespace editor {
 	public:
 		Workspace(const ax::Rect& rect);
 
+		~Workspace();
+
 	private:
 		ax::Font _font;
 		ax::Font _font_bold;
@@ -28,6 +30,7 @@ namespace editor {
 
 		ax::ScrollBar::Ptr _scrollBar;
 		std::vector<std::shared_ptr<WorkspaceObj>> _objs;
+		int _image_listener_id;
 
 		void OnMouseEnter(const ax::Point& pos);
 		void OnMouseLeave(const ax::Point& pos);
@@ -27,9 +27,9 @@ namespace editor {
 		void SetSelectable(bool selectable);
 
 	private:
-		ax::Font _font;
-		ax::Font _font_normal;
-		std::string _builder_name, _file_path, _title, _info, _size_str;
+		std::shared_ptr<ax::Font> _font;
+		std::shared_ptr<ax::Font> _font_normal;
+		std::string _builder_name, _file_path, _title, _info, _size_str, _img_path;
 		std::shared_ptr<ax::Image> _img;
 		ax::Size _img_size;
 		bool _show_text = true;
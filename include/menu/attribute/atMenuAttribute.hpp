@@ -39,7 +39,6 @@ namespace inspector {
 	private:
 		std::string _name;
 		std::string _value;
-		ax::Font _font;
 
 		void OnPaint(ax::GC gc);
 	};
@@ -38,8 +38,11 @@ namespace inspector {
 		BoolAttribute(
 			const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct);
 
+		void SetValue(const std::string& value);
+
 	private:
 		std::string _name;
+		ax::Toggle* _toggle;
 
 		axEVENT_DECLARATION(ax::Toggle::Msg, OnToggleClick);
 
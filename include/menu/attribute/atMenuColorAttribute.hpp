@@ -37,10 +37,11 @@ namespace inspector {
 		ColorAttribute(
 			const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct);
 
+		void SetValue(const std::string& value);
+
 	private:
 		std::string _name;
 		ax::Color _color;
-		ax::Font _font;
 
 		axEVENT_DECLARATION(ax::ColorPicker::Msg, OnColorSelect);
 		axEVENT_DECLARATION(ax::ColorPicker::Msg, OnColorCancel);
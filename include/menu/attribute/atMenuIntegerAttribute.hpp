@@ -37,8 +37,11 @@ namespace inspector {
 		IntegerAttribute(
 			const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct);
 
+		void SetValue(const std::string& value);
+
 	private:
 		std::string _name;
+		ax::NumberScroll* _scroll;
 		//		ax::Font _font;
 		//		ax::NumberScroll* _width_scroll;
 		//		ax::NumberScroll* _height_scroll;
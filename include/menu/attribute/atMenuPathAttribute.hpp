@@ -24,7 +24,6 @@ namespace inspector {
 	private:
 		std::string _name;
 		std::string _value;
-		ax::Font _font;
 
 		axEVENT_DECLARATION(ax::Button::Msg, OnOpenPath);
 		void OnPaint(ax::GC gc);
@@ -40,7 +40,7 @@ namespace inspector {
 
 	private:
 		std::string _name;
-		ax::Font _font;
+		std::shared_ptr<ax::Font> _font;
 		ax::NumberScroll* _width_scroll;
 		ax::NumberScroll* _height_scroll;
 
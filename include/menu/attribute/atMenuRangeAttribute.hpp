@@ -36,9 +36,11 @@ namespace inspector {
 		RangeAttribute(
 			const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct);
 
+		void SetValue(const std::string& value);
+
 	private:
 		std::string _name;
-		ax::Font _font;
+		std::shared_ptr<ax::Font> _font;
 		ax::NumberScroll* _left_scroll;
 		ax::NumberScroll* _right_scroll;
 
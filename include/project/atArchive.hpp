@@ -54,6 +54,12 @@ public:
 
 	bool AddDirectory(const std::string& name);
 
+	bool HasFile(const std::string& name);
+
+	bool RemoveFile(const std::string& name);
+
+	std::vector<std::string> GetFileNames();
+
 	bool ExtractArchive(const std::string& path);
 
 private:
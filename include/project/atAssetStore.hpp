@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace at {
+/*
+ * Name to content hash mapping of a content addressed store.
+ * Each blob is stored once under its hash, any number of names can refer to it.
+ */
+class AssetIndex {
+public:
+	/// Name of the serialized index inside a store.
+	static const std::string INDEX_NAME;
+
+	/// Folder holding the blobs inside a project archive.
+	static const std::string OBJECTS_FOLDER;
+
+	/// SHA-256 of content in hexadecimal, assets with the same hash share one blob.
+	static std::string HashContent(const char* data, std::size_t size);
+
+	/// Blob name for a hash, keeps the extension of the asset name.
+	static std::string GetObjectName(const std::string& hash, const std::string& name);
+
+	bool HasName(const std::string& name) const;
+
+	std::string GetHash(const std::string& name) const;
+
+	void SetName(const std::string& name, const std::string& hash);
+
+	void RemoveName(const std::string& name);
+
+	void Clear();
+
+	inline bool IsEmpty() const
+	{
+		return _entries.empty();
+	}
+
+	inline const std::map<std::string, std::string>& GetEntries() const
+	{
+		return _entries;
+	}
+
+	/// Returns true if at least one name refers to hash.
+	bool IsReferenced(const std::string& hash) const;
+
+	/// One "hash name" entry per line.
+	std::string Serialize() const;
+
+	bool Parse(const std::string& content);
+
+private:
+	std::map<std::string, std::string> _entries;
+};
+
+/*
+ * Content addressed store in a directory (used for the workspace).
+ * Blobs are written as <dir>/<hash>.<ext> next to the index file.
+ */
+class AssetDirectory {
+public:
+	AssetDirectory(const std::string& dir_path);
+
+	/// Stores data once and maps name to it. Returns stored file path, empty on error.
+	std::string AddContent(const std::string& name, const std::vector<char>& data);
+
+	/// Same as AddContent with the content of file_path. Source file is removed when remove_source is true.
+	std::string AddFile(const std::string& name, const std::string& file_path, bool remove_source = false);
+
+	/// Returns stored file path of name, empty if name isn't in the store.
+	std::string GetPath(const std::string& name) const;
+
+	inline const AssetIndex& GetIndex() const
+	{
+		return _index;
+	}
+
+private:
+	std::string _dir_path;
+	AssetIndex _index;
+
+	bool SaveIndex() const;
+};
+}
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "project/atArchive.hpp"
+#include "project/atAssetStore.hpp"
 #include <axlib/Util.hpp>
 #include <string>
 
@@ -44,6 +45,9 @@ public:
 
 	std::string GetScriptContent();
 
+	/// Content of a project file, resolved through the asset index.
+	std::vector<char> GetFileContent(const std::string& name);
+
 	bool IsValid() const
 	{
 		return _is_valid;
@@ -76,8 +80,14 @@ private:
 	std::string _tmp_folder_path;
 
 	at::FileArchive _archive;
+	at::AssetIndex _assets;
 	bool _is_valid;
 
+	void LoadAssetIndex();
+
+	/// Stores temp folder files once per content hash and closes the archive.
+	bool SaveTempFolderToArchive(at::FileArchive& archive, const std::string& name);
+
 	//	void CreateTempFiles(const std::string& folder_path);
 };
 }
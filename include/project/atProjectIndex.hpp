@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <axlib/axlib.hpp>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace at {
+/*
+ * Persistent index of projects and layouts metadata.
+ * Refreshed on a background thread, only files with a different modification time are read again.
+ */
+class ProjectIndex : public ax::event::Object {
+public:
+	enum Events : ax::event::Id { INDEX_UPDATED };
+
+	struct Entry {
+		std::string name;
+		std::string path;
+		std::string thumbnail;
+		std::time_t mtime;
+		int widget_count;
+		std::size_t script_size;
+	};
+
+	typedef std::function<void()> UpdateListener;
+
+	static ProjectIndex* GetInstance();
+
+	~ProjectIndex();
+
+	/// Files with extension (without dot) in dir_path are indexed.
+	void AddDirectory(const std::string& dir_path, const std::string& extension);
+
+	/// Index a file outside of indexed directories (e.g. opened project).
+	void AddFile(const std::string& path);
+
+	/// Starts a background refresh, or queues another one if a refresh is running.
+	/// INDEX_UPDATED is pushed when done.
+	void Refresh();
+
+	/// Listener is called on the ui thread after each refresh.
+	/// Returns the id to remove it with (e.g. from the destructor of its owner).
+	int AddUpdateListener(UpdateListener listener);
+
+	void RemoveUpdateListener(int id);
+
+	bool IsRefreshing() const
+	{
+		return _is_refreshing;
+	}
+
+	/// Entries with extension (without dot), most recently modified first.
+	std::vector<Entry> GetEntries(const std::string& extension) const;
+
+private:
+	static std::unique_ptr<ProjectIndex> _instance;
+
+	mutable std::mutex _mutex;
+	std::string _index_path;
+	std::vector<std::pair<std::string, std::string>> _directories;
+	std::vector<std::string> _files;
+	std::map<std::string, Entry> _entries;
+
+	std::thread _refresh_thread;
+	std::atomic<bool> _is_refreshing;
+	bool _refresh_again;
+
+	// Only accessed from the ui thread.
+	std::map<int, UpdateListener> _update_listeners;
+	int _next_listener_id;
+
+	ProjectIndex();
+
+	void RefreshThread();
+
+	void RefreshEntries();
+
+	void OnIndexUpdated(ax::event::Msg* msg);
+
+	bool Load();
+
+	bool Save() const;
+
+	static Entry ReadEntry(const std::string& path, std::time_t mtime);
+};
+}
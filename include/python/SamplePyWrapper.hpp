@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#pragma once
+
+#include "atSampleCache.hpp"
+#include <boost/python.hpp>
+
+namespace ax {
+namespace python {
+
+	/// Python handle to a sample of the process wide sample cache.
+	class Sample {
+	public:
+		Sample(at::SampleCache::Ptr sample);
+
+		bool IsValid() const;
+
+		int GetChannels() const;
+
+		int GetSampleRate() const;
+
+		int GetFrames() const;
+
+		std::string GetHash() const;
+
+		float GetValue(int frame, int channel) const;
+
+		/// Read only memoryview of the interleaved PCM as float32 items (format "f", no copy).
+		/// Keeps the Sample object alive as long as the view exists.
+		static boost::python::object GetBuffer(boost::python::object self);
+
+	private:
+		at::SampleCache::Ptr _sample;
+
+		// Referenced by exported buffers, live as long as this object.
+		Py_ssize_t _buffer_shape;
+		Py_ssize_t _buffer_stride;
+	};
+
+	Sample LoadSample(const std::string& path);
+
+	void export_python_wrapper_sample();
+}
+}
@@ -216,6 +216,31 @@ inline void pyo_set_server_params(PyThreadState* interp, float sr, int bufsize)
 
 std::string pyo_GetClassBriefDoc(PyThreadState* interp, const std::string& module_name);
 
+/*
+** Create a sub-interpreter without pyo server, used to compile scripts
+** without touching the running audio interpreter.
+*/
+inline PyThreadState* pyo_new_compile_interpreter()
+{
+	if (!Py_IsInitialized()) {
+		Py_Initialize();
+		PyEval_InitThreads();
+		PyEval_ReleaseLock();
+	}
+
+	PyEval_AcquireLock();
+	PyThreadState* interp = Py_NewInterpreter();
+	PyEval_ReleaseThread(interp);
+
+	return interp;
+}
+
+/*
+** Compile "code" without executing it. Returns false on syntax error with
+** the error line (starting at 1, 0 if unknown) and message.
+*/
+bool pyo_compile_check(PyThreadState* interp, const std::string& code, int& line, std::string& msg);
+
 /*
 ** Add a MIDI event in the pyo server processing chain. When used in
 ** an embedded framework, pyo can't open MIDI ports by itself. MIDI
@@ -23,6 +23,7 @@
  */
 
 #include "PyoAudio.h"
+#include "atSampleCache.hpp"
 #include <axlib/Util.hpp>
 
 PyoAudio* PyoAudio::_global_audio = nullptr;
@@ -62,6 +63,11 @@ void PyoAudio::ReloadScript(const std::string& path)
 	ax::console::Print("Debug reload");
 	StopAudio();
 
+	// Samples of the previous script are released with the interpreter. Keep them until the new script
+	// ran so the ones it loads again are never evicted in between and come back without decoding.
+	const std::vector<at::SampleCache::Ptr> previous_samples
+		= at::SampleCache::GetInstance()->GetUsedSamples();
+
 	if (_pyo != nullptr) {
 		pyo_end_interpreter(_pyo);
 	}
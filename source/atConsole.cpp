@@ -25,9 +25,13 @@
 #include "atConsole.h"
 #include "atConsoleStream.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace at {
-Console::Console(const ax::Rect& rect)
+Console::Console(const ax::Rect& rect, int capacity)
 	: _font(0)
+	, _lines(std::max(capacity, 1))
 {
 	win = ax::Window::Create(rect);
 	win->event.OnPaint = ax::WBind<ax::GC>(this, &Console::OnPaint);
@@ -37,20 +41,19 @@ Console::Console(const ax::Rect& rect)
 	win->event.OnMouseEnterChild = ax::WBind<ax::Point>(this, &Console::OnMouseEnterChild);
 	win->event.OnMouseLeave = ax::WBind<ax::Point>(this, &Console::OnMouseLeave);
 	win->event.OnMouseLeaveChild = ax::WBind<ax::Point>(this, &Console::OnMouseLeaveChild);
+	win->AddConnection(FLUSH_LINES, GetOnFlushLines());
 
 	at::ConsoleStream::GetInstance()->AddConnection(at::ConsoleStream::WRITE_NEW_LINE, GetOnConsoleUpdate());
 	at::ConsoleStream::GetInstance()->AddConnection(
 		at::ConsoleStream::WRITE_ERROR, GetOnConsoleErrorUpdate());
-	at::ConsoleStream::GetInstance()->Write("Console init.");
+	at::ConsoleStream::GetInstance()->Write("Console init.", LogStore::EDITOR);
 
+	// Only shown rows are drawn, scrollbar is used as a slider on the line index.
 	_panel = ax::Window::Create(ax::Rect(0, 0, rect.size.w, rect.size.h));
+	_panel->event.OnPaint = ax::WBind<ax::GC>(this, &Console::OnPanelPaint);
+	_panel->property.AddProperty("BlockDrawing");
 	win->node.Add(std::shared_ptr<ax::Window>(_panel));
 
-	_txt_panel = ax::Window::Create(ax::Rect(0, 0, rect.size.w, rect.size.h));
-	_panel->node.Add(std::shared_ptr<ax::Window>(_txt_panel));
-
-	_txt_panel->event.OnPaint = ax::WBind<ax::GC>(this, &Console::OnPanelPaint);
-
 	ax::ScrollBar::Info sInfo;
 	sInfo.normal = ax::Color(0.80, 0.3);
 	sInfo.hover = ax::Color(0.85, 0.3);
@@ -60,84 +63,156 @@ Console::Console(const ax::Rect& rect)
 	sInfo.bg_top = ax::Color(0.9, 0.2);
 	sInfo.bg_bottom = ax::Color(0.92, 0.2);
 
+	ax::ScrollBar::Events scroll_evts;
+	scroll_evts.value_change = GetOnScroll();
+
 	ax::Rect sRect(rect.size.w - 9, 0, 10, rect.size.h);
-	_scrollBar = ax::shared<ax::ScrollBar>(sRect, ax::ScrollBar::Events(), sInfo);
+	_scrollBar = ax::shared<ax::ScrollBar>(sRect, scroll_evts, sInfo);
 
 	win->node.Add(_scrollBar);
 
-	_panel->property.AddProperty("BlockDrawing");
-	_panel->dimension.SetSizeNoShowRect(ax::Size(rect.size.w, rect.size.h));
-
-	_scrollBar->SetWindowHandle(_panel);
-	_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
+	_scrollBar->UpdateWindowSize(rect.size);
 }
 
 void Console::Clear()
 {
-	_lines.clear();
+	_first_line = 0;
+	_n_lines = 0;
+	_log_start = LogStore::GetInstance()->GetSize();
+	_filter.indexes.clear();
+	_filter.n_checked = _log_start;
+	_first_shown_line = 0;
 	_scrollBar->SetZeroToOneValue(0.0);
-	_panel->dimension.SetSizeNoShowRect(ax::Size(win->dimension.GetSize()));
-	_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
-	_txt_panel->Update();
+	UpdateScrollBar();
 	_panel->Update();
 }
 
-void Console::OnConsoleUpdate(const ax::event::StringMsg& msg)
+void Console::SetCapacity(int capacity)
 {
-	std::vector<std::string> lines = ax::util::String::Split(msg.GetMsg(), "\n");
+	capacity = std::max(capacity, 1);
 
-	for (int i = 0; i < lines.size(); i++) {
-		bool new_block = false;
-		if (i == 0) {
-			new_block = true;
-		}
+	// Keep most recent lines in order.
+	const std::size_t n_kept = std::min(_n_lines, (std::size_t)capacity);
+	std::vector<MessageFormat> lines(capacity);
+
+	for (std::size_t i = 0; i < n_kept; i++) {
+		lines[i] = std::move(_lines[(_first_line + _n_lines - n_kept + i) % _lines.size()]);
+	}
+
+	_lines.swap(lines);
+	_first_line = 0;
+	_n_lines = n_kept;
+	UpdateScrollBar();
+	_panel->Update();
+}
+
+void Console::SetFilter(int severity_mask, int source_mask, const std::string& text)
+{
+	_filter.active = true;
+	_filter.severity_mask = severity_mask;
+	_filter.source_mask = source_mask;
+	_filter.text = text;
+	_filter.indexes.clear();
+	_filter.n_checked = _log_start;
+
+	UpdateFilter();
+	_first_shown_line = 0;
+	_scrollBar->SetZeroToOneValue(0.0);
+	UpdateScrollBar();
+	_panel->Update();
+}
+
+void Console::ClearFilter()
+{
+	_filter = Filter();
+	_scrollBar->SetZeroToOneValue(1.0);
+	UpdateScrollBar();
+	_panel->Update();
+}
+
+void Console::UpdateFilter()
+{
+	// Only entries added since last update are checked.
+	LogStore* log = LogStore::GetInstance();
+	log->Filter(_filter.severity_mask, _filter.source_mask, _filter.text, _filter.n_checked, _filter.indexes);
+	_filter.n_checked = log->GetSize();
+}
+
+void Console::AddLines(const std::string& msg, int type)
+{
+	std::vector<std::string> lines = ax::util::String::Split(msg, "\n");
+	_block_flip = !_block_flip;
 
-		if (i == lines.size() - 1 && lines[i].empty()) {
+	for (int i = 0; i < lines.size(); i++) {
+		if (type == 0 && i == lines.size() - 1 && lines[i].empty()) {
 			continue;
 		}
 
-		_lines.push_back(MessageFormat(new_block, 0, lines[i]));
+		// Overwrite oldest line when full.
+		if (_n_lines == _lines.size()) {
+			_lines[_first_line] = MessageFormat(_block_flip, type, lines[i]);
+			_first_line = (_first_line + 1) % _lines.size();
+		}
+		else {
+			_lines[(_first_line + _n_lines) % _lines.size()] = MessageFormat(_block_flip, type, lines[i]);
+			_n_lines++;
+		}
 	}
 
-	int panel_height = 10 + int(_lines.size()) * 15;
-	_txt_panel->dimension.SetSize(ax::Size(_panel->dimension.GetSize().w, panel_height));
-	_panel->dimension.SetSizeNoShowRect(ax::Size(_panel->dimension.GetSize().w, panel_height));
-	_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
-
-	if (_txt_panel->dimension.GetSize().h > _panel->dimension.GetShownRect().size.h) {
-		_scrollBar->SetZeroToOneValue(1.0);
+	// Every message received before the flush event is handled ends up in a single repaint.
+	if (!_flush_pending) {
+		_flush_pending = true;
+		win->PushEvent(FLUSH_LINES, new ax::event::EmptyMsg());
 	}
+}
 
-	_txt_panel->Update();
+void Console::UpdateScrollBar()
+{
+	const ax::Size size(_panel->dimension.GetSize());
+	const int content_height = std::max(size.h, 10 + GetNumberOfRows() * LINE_HEIGHT);
+	_scrollBar->UpdateWindowSize(ax::Size(size.w, content_height));
+}
+
+void Console::OnConsoleUpdate(const ax::event::StringMsg& msg)
+{
+	AddLines(msg.GetMsg(), 0);
 }
 
 void Console::OnConsoleErrorUpdate(const ax::event::StringMsg& msg)
 {
 	// Set event to bottom section to flip to console on error.
 	win->PushEvent(WRITE_ERROR, new ax::event::EmptyMsg());
+	AddLines(msg.GetMsg(), 1);
+}
 
-	std::vector<std::string> lines = ax::util::String::Split(msg.GetMsg(), "\n");
-
-	for (int i = 0; i < lines.size(); i++) {
-		bool new_block = false;
-		if (i == 0) {
-			new_block = true;
-		}
+void Console::OnFlushLines(const ax::event::EmptyMsg& msg)
+{
+	_flush_pending = false;
 
-		_lines.push_back(MessageFormat(new_block, 1, lines[i]));
+	if (_filter.active) {
+		UpdateFilter();
 	}
 
-	int panel_height = 10 + int(_lines.size()) * 15;
-	_txt_panel->dimension.SetSize(ax::Size(_panel->dimension.GetSize().w, panel_height));
-	_panel->dimension.SetSizeNoShowRect(ax::Size(_panel->dimension.GetSize().w, panel_height));
+	UpdateScrollBar();
 
-	_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
+	const int n_rows = GetNumberOfRows();
+	const int n_shown = _panel->dimension.GetSize().h / LINE_HEIGHT;
 
-	if (_txt_panel->dimension.GetSize().h > _panel->dimension.GetShownRect().size.h) {
+	// Follow new lines.
+	if (n_rows > n_shown) {
+		_first_shown_line = n_rows - n_shown;
 		_scrollBar->SetZeroToOneValue(1.0);
 	}
 
-	_txt_panel->Update();
+	_panel->Update();
+}
+
+void Console::OnScroll(const ax::ScrollBar::Msg& msg)
+{
+	const int n_shown = _panel->dimension.GetSize().h / LINE_HEIGHT;
+	const int diff = std::max(0, GetNumberOfRows() - n_shown);
+	_first_shown_line = (int)std::ceil(_scrollBar->GetZeroToOneValue() * diff);
+	_panel->Update();
 }
 
 void Console::OnMouseEnter(const ax::Point& pos)
@@ -169,16 +244,15 @@ void Console::OnScrollWheel(const ax::Point& delta)
 	double scroll_value
 		= (delta.y / (double)ax::App::GetInstance().GetFrameSize().h) + _scrollBar->GetZeroToOneValue();
 
-	_scrollBar->SetZeroToOneValue(scroll_value);
+	_scrollBar->SetZeroToOneValue(ax::util::Clamp(scroll_value, 0.0, 1.0));
 }
 
 void Console::OnResize(const ax::Size& size)
 {
 	ax::Rect sRect(size.w - 9, 0, 10, size.h);
 	_scrollBar->GetWindow()->dimension.SetRect(sRect);
-	_panel->dimension.SetShownRect(ax::Rect(0, 0, size.w, size.h));
-	_txt_panel->dimension.SetSize(ax::Size(size.w, _txt_panel->dimension.GetSize().h));
-	_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
+	_panel->dimension.SetSize(size);
+	UpdateScrollBar();
 }
 
 void Console::OnPaint(ax::GC gc)
@@ -191,26 +265,38 @@ void Console::OnPaint(ax::GC gc)
 
 void Console::OnPanelPaint(ax::GC gc)
 {
-	const ax::Rect rect(_txt_panel->dimension.GetDrawingRect());
+	const ax::Rect rect(_panel->dimension.GetDrawingRect());
 	gc.SetColor(ax::Color(1.0));
 	gc.DrawRectangle(rect);
 
-	const int line_height = 15;
-
 	ax::Point pos(5, 5);
-	gc.SetColor(ax::Color(0.0));
 
-	bool block_flip = false;
+	// Only draw rows inside the panel.
+	const int n_shown = rect.size.h / LINE_HEIGHT + 1;
+	const int n_rows = GetNumberOfRows();
+	const int first_line = std::max(0, std::min(_first_shown_line, n_rows - 1));
+	const int last_line = std::min(n_rows, first_line + n_shown);
+	LogStore* log = LogStore::GetInstance();
+
+	MessageFormat entry_line;
 
-	for (auto& n : _lines) {
-		if (n.new_block) {
-			block_flip = !block_flip;
+	for (int i = first_line; i < last_line; i++) {
+		const MessageFormat* line = &entry_line;
+
+		if (_filter.active) {
+			const LogStore::Entry entry = log->GetEntry(_filter.indexes[i]);
+			const int type = entry.severity == LogStore::INFO ? 0 : 1;
+			entry_line = MessageFormat(i % 2 == 0, type, log->GetMessage(entry.msg_id));
+		}
+		else {
+			line = &GetLine(i);
 		}
 
-		ax::Rect line_rect(rect.position.x, pos.y, rect.size.w, 15);
+		const MessageFormat& n = *line;
+		ax::Rect line_rect(rect.position.x, pos.y, rect.size.w, LINE_HEIGHT);
 
 		// Draw bg.
-		if (block_flip) {
+		if (n.block_flip) {
 			gc.DrawRectangleColorFade(line_rect, ax::Color(1.0), ax::Color(0.98));
 		}
 		else {
@@ -225,7 +311,7 @@ void Console::OnPanelPaint(ax::GC gc)
 		}
 
 		gc.DrawString(_font, n.msg, pos);
-		pos.y += line_height;
+		pos.y += LINE_HEIGHT;
 	}
 
 	gc.SetColor(ax::Color(1.0));
@@ -14,7 +14,13 @@ std::unique_ptr<ConsoleStream> ConsoleStream::_instance = nullptr;
 
 ConsoleStream::ConsoleStream()
 	: ax::event::Object(ax::App::GetInstance().GetEventManager())
+	, _head(nullptr)
+	, _pending(0)
+	, _dropped(0)
+	, _total_dropped(0)
+	, _drain_scheduled(false)
 {
+	AddConnection(DRAIN_QUEUE, ax::event::Function([this](ax::event::Msg* msg) { Drain(); }));
 }
 
 // void ConsoleStream::Write()
@@ -23,14 +29,128 @@ ConsoleStream::ConsoleStream()
 ////	PushEvent(WRITE_NEW_LINE, new ax::event::SimpleMsg<int>(0));
 //}
 
-void ConsoleStream::Write(const std::string& msg)
+void ConsoleStream::Write(const std::string& msg, LogStore::Source source)
 {
-	PushEvent(WRITE_NEW_LINE, new ax::event::StringMsg(msg));
+	Push(WRITE_NEW_LINE, source, msg);
 }
 
-void ConsoleStream::Error(const std::string& err_msg)
+void ConsoleStream::Error(const std::string& err_msg, LogStore::Source source)
 {
-	PushEvent(WRITE_ERROR, new ax::event::StringMsg(err_msg));
+	Push(WRITE_ERROR, source, err_msg);
+}
+
+void ConsoleStream::Push(Events type, LogStore::Source source, const std::string& msg)
+{
+	// Never wait on the ui, drop when it's behind. Messages are still allocated (as are the strings
+	// built by callers), so this isn't meant to be called from the audio callback itself.
+	if (_pending.fetch_add(1) >= MAX_PENDING_MESSAGES) {
+		_pending.fetch_sub(1);
+		_dropped.fetch_add(1);
+		_total_dropped.fetch_add(1);
+		return;
+	}
+
+	const std::int64_t time = LogStore::GetTime();
+	Message* node = new Message{ type, source, time, msg, _head.load(std::memory_order_relaxed) };
+
+	while (!_head.compare_exchange_weak(
+		node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+
+	// Only one drain event is waiting in the event queue at any time.
+	if (!_drain_scheduled.exchange(true)) {
+		PushEvent(DRAIN_QUEUE, new ax::event::EmptyMsg());
+	}
+}
+
+void ConsoleStream::Drain()
+{
+	// Messages pushed after this point schedule a new drain.
+	_drain_scheduled.store(false);
+	Message* node = _head.exchange(nullptr, std::memory_order_acquire);
+
+	// Stack is in reverse order.
+	Message* first = nullptr;
+
+	while (node != nullptr) {
+		Message* next = node->next;
+		node->next = first;
+		first = node;
+		node = next;
+	}
+
+	LogStore* log = LogStore::GetInstance();
+
+	// Adjacent messages of the same type are sent as a single message,
+	// consecutive duplicates are counted instead of repeated.
+	std::string text;
+	std::string last;
+	Events type = WRITE_NEW_LINE;
+	int count = 0;
+	int n_received = 0;
+
+	auto append_last = [&]() {
+		if (!text.empty() && text.back() != '\n') {
+			text += '\n';
+		}
+
+		if (count == 1) {
+			text += last;
+			return;
+		}
+
+		// Count goes before the trailing new line.
+		const bool new_line = !last.empty() && last.back() == '\n';
+		text += last.substr(0, last.size() - new_line) + " (x" + std::to_string(count) + ")";
+	};
+
+	while (first != nullptr) {
+		std::unique_ptr<Message> msg(first);
+		first = first->next;
+		n_received++;
+
+		// Every line is kept in the log store, merging only applies to what is sent to the console.
+		const LogStore::Severity severity = msg->type == WRITE_ERROR ? LogStore::ERROR : LogStore::INFO;
+
+		for (auto& line : ax::util::String::Split(msg->msg, "\n")) {
+			if (!line.empty()) {
+				log->Add(msg->time, severity, msg->source, line);
+			}
+		}
+
+		if (count && msg->type == type && msg->msg == last) {
+			count++;
+			continue;
+		}
+
+		if (count) {
+			append_last();
+
+			if (msg->type != type) {
+				PushEvent(type, new ax::event::StringMsg(text));
+				text.clear();
+			}
+		}
+
+		type = msg->type;
+		last = std::move(msg->msg);
+		count = 1;
+	}
+
+	if (count) {
+		append_last();
+		PushEvent(type, new ax::event::StringMsg(text));
+	}
+
+	_pending.fetch_sub(n_received);
+
+	const int dropped = _dropped.exchange(0);
+
+	if (dropped) {
+		const std::string drop_msg = std::to_string(dropped) + " console messages dropped.";
+		log->Add(LogStore::GetTime(), LogStore::WARNING, LogStore::EDITOR, drop_msg);
+		PushEvent(WRITE_ERROR, new ax::event::StringMsg(drop_msg));
+	}
 }
 
 // void ConsoleStream::Error()
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "atLogStore.hpp"
+#include <axlib/Util.hpp>
+
+#include <chrono>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace at {
+std::unique_ptr<LogStore> LogStore::_instance = nullptr;
+
+LogStore* LogStore::GetInstance()
+{
+	if (_instance == nullptr) {
+		_instance.reset(new LogStore());
+	}
+
+	return _instance.get();
+}
+
+std::int64_t LogStore::GetTime()
+{
+	using namespace std::chrono;
+	return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+LogStore::LogStore()
+	: _spill_fd(-1)
+	, _spill_map(nullptr)
+	, _n_spilled(0)
+{
+	_entries.reserve(SPILL_THRESHOLD);
+
+	const char* tmp_dir = getenv("TMPDIR");
+	std::string path = std::string(tmp_dir ? tmp_dir : "/tmp") + "/at_log_" + std::to_string(getpid());
+
+	_spill_fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+	if (_spill_fd == -1) {
+		ax::console::Error("Can't create log spill file", path, ", log entries will stay in memory.");
+		return;
+	}
+
+	// File is removed by the system when closed.
+	unlink(path.c_str());
+}
+
+LogStore::~LogStore()
+{
+	if (_spill_map != nullptr) {
+		munmap((void*)_spill_map, _n_spilled * sizeof(Entry));
+	}
+
+	if (_spill_fd != -1) {
+		close(_spill_fd);
+	}
+}
+
+void LogStore::Add(std::int64_t time, Severity severity, Source source, const std::string& msg)
+{
+	auto it = _message_ids.find(msg);
+
+	if (it == _message_ids.end()) {
+		it = _message_ids.insert(std::make_pair(msg, (std::uint32_t)_messages.size())).first;
+		_messages.push_back(&it->first);
+	}
+
+	_entries.push_back(Entry{ time, it->second, severity, source });
+
+	if (_entries.size() >= SPILL_THRESHOLD && _spill_fd != -1) {
+		Spill();
+	}
+}
+
+LogStore::Entry LogStore::GetEntry(std::size_t index) const
+{
+	if (index < _n_spilled) {
+		return _spill_map[index];
+	}
+
+	return _entries[index - _n_spilled];
+}
+
+void LogStore::Spill()
+{
+	const std::size_t bytes = _entries.size() * sizeof(Entry);
+	const char* data = reinterpret_cast<const char*>(_entries.data());
+	std::size_t written = 0;
+
+	while (written < bytes) {
+		const ssize_t n = write(_spill_fd, data + written, bytes - written);
+
+		if (n <= 0) {
+			ax::console::Error("Can't write log spill file, log entries will stay in memory.");
+			close(_spill_fd);
+			_spill_fd = -1;
+			return;
+		}
+
+		written += n;
+	}
+
+	const std::size_t n_spilled = _n_spilled + _entries.size();
+	void* map = mmap(nullptr, n_spilled * sizeof(Entry), PROT_READ, MAP_SHARED, _spill_fd, 0);
+
+	if (map == MAP_FAILED) {
+		// Keep entries in memory, file content past _n_spilled is overwritten on next spill.
+		ax::console::Error("Can't map log spill file.");
+		lseek(_spill_fd, _n_spilled * sizeof(Entry), SEEK_SET);
+		return;
+	}
+
+	if (_spill_map != nullptr) {
+		munmap((void*)_spill_map, _n_spilled * sizeof(Entry));
+	}
+
+	_spill_map = static_cast<const Entry*>(map);
+	_n_spilled = n_spilled;
+	_entries.clear();
+}
+
+void LogStore::UpdateSearch(const std::string& text)
+{
+	if (text != _search_text) {
+		_search_text = text;
+		_search_matches.clear();
+	}
+
+	// Only messages interned since last search are checked.
+	for (std::size_t i = _search_matches.size(); i < _messages.size(); i++) {
+		_search_matches.push_back(_messages[i]->find(_search_text) != std::string::npos);
+	}
+}
+
+void LogStore::Filter(int severity_mask, int source_mask, const std::string& text, std::size_t first,
+	std::vector<std::size_t>& indexes)
+{
+	const bool search = !text.empty();
+
+	if (search) {
+		UpdateSearch(text);
+	}
+
+	for (std::size_t i = first; i < GetSize(); i++) {
+		const Entry entry = GetEntry(i);
+
+		if (!(severity_mask & (1 << entry.severity)) || !(source_mask & (1 << entry.source))) {
+			continue;
+		}
+
+		if (search && !_search_matches[entry.msg_id]) {
+			continue;
+		}
+
+		indexes.push_back(i);
+	}
+}
+}
@@ -11,6 +11,7 @@
 #include "editor/atEditorMainWindow.hpp"
 
 #include "project/atArchive.hpp"
+#include "project/atProjectIndex.hpp"
 #include <boost/filesystem.hpp>
 
 namespace at {
@@ -183,6 +184,8 @@ namespace editor {
 			return false;
 		}
 
+		at::ProjectIndex::GetInstance()->AddFile(project_path);
+
 		// Remove selected widget from right side menu.
 		_main_window->_selected_windows.clear();
 		_main_window->_right_menu->SetInspectorHandle(nullptr);
@@ -263,6 +266,8 @@ namespace editor {
 			return false;
 		}
 
+		at::ProjectIndex::GetInstance()->AddFile(filepath.string() + ".atproj");
+
 		// Remove selected widget from right side menu.
 		_main_window->_selected_windows.clear();
 		_main_window->_right_menu->SetInspectorHandle(nullptr);
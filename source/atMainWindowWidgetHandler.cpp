@@ -9,14 +9,17 @@
 #include "atMainWindowWidgetHandler.h"
 #include "atHelpBar.h"
 #include "editor/atEditorLoader.hpp"
+#include "editor/atEditorWidgetPrototype.hpp"
 #include "editor/atEditorMainWindow.hpp"
 
 #include <axlib/Panel.hpp>
 #include <axlib/WidgetLoader.hpp>
+#include <algorithm>
 #include <fst/print.h>
 
 #include "editor/atEditor.hpp"
 #include "editor/atEditorGridWindow.hpp"
+#include "editor/atEditorGroupTransform.hpp"
 //#include "editor/atEditorMainWindow.hpp"
 
 namespace at {
@@ -29,10 +32,8 @@ namespace editor {
 
 	void MainWindowWidgetHandler::DeleteCurrentWidgets()
 	{
-		// Remove all selected widgets.
-		for (auto& n : _main_window->_selected_windows) {
-			n->RemoveWindow();
-		}
+		// Remove all selected widgets (kept in journal for undo).
+		_main_window->_gridWindow->GetJournal().RemoveWidgets(_main_window->_selected_windows);
 
 		// Clear selected widget vector.
 		_main_window->_selected_windows.clear();
@@ -51,6 +52,7 @@ namespace editor {
 	{
 		ax::Window* selected_win = msg.GetMsg();
 		_main_window->_selected_windows.clear();
+		_main_window->_gridWindow->GetJournal().BreakMerging();
 
 		_main_window->_right_menu->SetMultipleWidgetSelected(false);
 		_main_window->_gridWindow->UnSelectAllWidgets();
@@ -76,6 +78,7 @@ namespace editor {
 
 	void MainWindowWidgetHandler::OnUnSelectAllWidget(const ax::event::SimpleMsg<int>& msg)
 	{
+		_main_window->_gridWindow->GetJournal().BreakMerging();
 		_main_window->_selected_windows.clear();
 		_main_window->_right_menu->RemoveInspectorHandle();
 	}
@@ -129,6 +132,30 @@ namespace editor {
 		std::string file_path = obj_info.second;
 		ax::Point pos(msg.GetMsg().second);
 
+		// Custom widget files are only parsed on first drop.
+		std::shared_ptr<WidgetPrototype> prototype = WidgetPrototype::GetCustomWidget(file_path);
+
+		if (prototype != nullptr) {
+			std::vector<std::shared_ptr<ax::Window::Backbone>> clones = prototype->Clone(false);
+
+			if (clones.empty() || clones[0] == nullptr) {
+				return;
+			}
+
+			ax::App& app(ax::App::GetInstance());
+			app.GetPopupManager()->Clear();
+
+			ax::Window* obj_win = clones[0]->GetWindow();
+			obj_win->dimension.SetPosition(pos);
+			app.AddPopupTopLevel(clones[0]);
+
+			obj_win->property.RemoveProperty("Selectable");
+			_has_tmp_widget = true;
+			_tmp_widget_builder_name
+				= obj_win->component.Get<ax::widget::Component>("Widget")->GetBuilderName();
+			return;
+		}
+
 		ax::widget::Loader* loader = ax::widget::Loader::GetInstance();
 		ax::Xml xml(file_path);
 
@@ -179,6 +206,8 @@ namespace editor {
 		auto obj(builder->Create(wnode));
 
 		if (obj != nullptr) {
+			WidgetPrototype::AddCustomWidget(
+				file_path, std::make_shared<WidgetPrototype>(std::vector<ax::Window*>(1, obj->GetWindow())));
 
 			app.AddPopupTopLevel(obj);
 
@@ -290,6 +319,8 @@ namespace editor {
 				}
 			}
 
+			_main_window->_gridWindow->InvalidateWidgetIndex();
+
 			// Is inside grid window.
 			ax::Window* hover_window
 				= ax::App::GetInstance().GetWindowManager()->GetWindowTree()->FindMousePosition(pos);
@@ -312,6 +343,7 @@ namespace editor {
 				// Setup widget.
 				Loader loader(_main_window->_gridWindow->GetWindow());
 				loader.SetupExistingWidget(widget_win.get(), _tmp_widget_builder_name);
+				_main_window->_gridWindow->GetJournal().RecordAdd(widget_win.get());
 
 				_main_window->_selected_windows.clear();
 				_main_window->_gridWindow->UnSelectAllWidgets();
@@ -342,6 +374,7 @@ namespace editor {
 				// Setup widget.
 				Loader loader(_main_window->_gridWindow->GetWindow());
 				loader.SetupExistingWidget(widget_win.get(), _tmp_widget_builder_name);
+				_main_window->_gridWindow->GetJournal().RecordAdd(widget_win.get());
 
 				_main_window->_gridWindow->UnSelectAllWidgets();
 				_main_window->_selected_windows.clear();
@@ -369,45 +402,70 @@ namespace editor {
 
 	void MainWindowWidgetHandler::OnDuplicateSelectedWidget(const ax::event::EmptyMsg& msg)
 	{
-		std::vector<ax::Window*> sel_wins = _main_window->GetSelectedWindows();
+		std::vector<ax::Window*> sel_wins;
+		ax::Window* gwin = _main_window->_gridWindow->GetWindow();
 
-		if (sel_wins.size()) {
-			// Copy selected widgets.
-			std::shared_ptr<ax::Window::Backbone> bck_bone(sel_wins[0]->backbone->GetCopy());
+		for (auto& n : _main_window->GetSelectedWindows()) {
+			ax::Window* parent = n->node.GetParent();
 
-			if (bck_bone == nullptr) {
-				return;
+			// Can't duplicate main panel widget.
+			if (parent != nullptr && parent != gwin) {
+				sel_wins.push_back(n);
 			}
+		}
 
-			const ax::Rect rect(sel_wins[0]->dimension.GetRect());
+		if (sel_wins.empty()) {
+			return;
+		}
 
-			bck_bone->GetWindow()->dimension.SetPosition(rect.position + ax::Point(rect.size.w + 2, 0));
+		// Copy selected widgets with their child widgets and components.
+		WidgetPrototype prototype(sel_wins);
+		std::vector<std::shared_ptr<ax::Window::Backbone>> copies = prototype.Clone();
+		const std::vector<ax::Window*>& sources = prototype.GetSourceWidgets();
 
-			at::editor::Loader loader(_main_window->_gridWindow->GetWindow());
-			ax::widget::Component* widget
-				= static_cast<ax::widget::Component*>(bck_bone->GetWindow()->component.Get("Widget").get());
+		// Copies are placed on the right of the selection.
+		int left = 0;
+		int right = 0;
 
-			ax::Window* parent = sel_wins[0]->node.GetParent();
+		for (std::size_t i = 0; i < sources.size(); i++) {
+			const ax::Rect rect(sources[i]->dimension.GetAbsoluteRect());
+			left = i == 0 ? rect.position.x : std::min(left, rect.position.x);
+			right = i == 0 ? rect.position.x + rect.size.w : std::max(right, rect.position.x + rect.size.w);
+		}
 
-			if (parent == nullptr) {
-				return;
-			}
+		const ax::Point delta(right - left + 2, 0);
+		std::vector<ax::Window*> added;
 
-			// Can't duplicate main panel widget.
-			if (parent->GetId() == _main_window->_gridWindow->GetWindow()->GetId()) {
-				return;
+		for (std::size_t i = 0; i < copies.size(); i++) {
+			if (copies[i] == nullptr) {
+				continue;
 			}
 
-			parent->node.Add(bck_bone);
-			loader.SetupExistingWidget(bck_bone->GetWindow(), widget->GetBuilderName());
+			ax::Window* copy_win = copies[i]->GetWindow();
+			copy_win->dimension.SetPosition(sources[i]->dimension.GetRect().position + delta);
+			sources[i]->node.GetParent()->node.Add(copies[i]);
+			added.push_back(copy_win);
+		}
+
+		if (added.empty()) {
+			return;
+		}
+
+		_main_window->_gridWindow->GetJournal().RecordAdd(added);
+		_main_window->_gridWindow->InvalidateWidgetIndex();
 
-			OnSelectWidget(ax::event::SimpleMsg<ax::Window*>(bck_bone->GetWindow()));
+		if (added.size() == 1) {
+			OnSelectWidget(ax::event::SimpleMsg<ax::Window*>(added[0]));
+		}
+		else {
+			OnSelectMultipleWidget(ax::event::SimpleMsg<std::vector<ax::Window*>>(added));
 		}
 	}
 
 	void MainWindowWidgetHandler::OnSelectMultipleWidget(
 		const ax::event::SimpleMsg<std::vector<ax::Window*>>& msg)
 	{
+		_main_window->_gridWindow->GetJournal().BreakMerging();
 		_main_window->_gridWindow->UnSelectAllWidgets();
 
 		ax::console::Print("Select multiple widget.");
@@ -433,24 +491,22 @@ namespace editor {
 		const ax::event::SimpleMsg<ax::util::Direction>& msg)
 	{
 		const ax::util::Direction dir = msg.GetMsg();
+		ax::Point delta(0, 1);
 
-		for (auto& n : _main_window->_selected_windows) {
-			const ax::Rect& w_rect = n->dimension.GetRect();
-
-			if (dir == ax::util::Direction::LEFT) {
-				n->dimension.SetPosition(w_rect.position - ax::Point(1, 0));
-			}
-			else if (dir == ax::util::Direction::RIGHT) {
-				n->dimension.SetPosition(w_rect.position + ax::Point(1, 0));
-			}
-			else if (dir == ax::util::Direction::UP) {
-				n->dimension.SetPosition(w_rect.position - ax::Point(0, 1));
-			}
-			// Down.
-			else {
-				n->dimension.SetPosition(w_rect.position + ax::Point(0, 1));
-			}
+		if (dir == ax::util::Direction::LEFT) {
+			delta = ax::Point(-1, 0);
+		}
+		else if (dir == ax::util::Direction::RIGHT) {
+			delta = ax::Point(1, 0);
 		}
+		else if (dir == ax::util::Direction::UP) {
+			delta = ax::Point(0, -1);
+		}
+
+		// Inspector already listens to ARROW_MOVE_SELECTED_WIDGET.
+		GroupTransform transform(_main_window->_gridWindow.get(), _main_window->_selected_windows);
+		transform.Translate(delta);
+		transform.Commit(GroupTransform::RECORD_UNDO | GroupTransform::MERGE_UNDO);
 	}
 }
 }
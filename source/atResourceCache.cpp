@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "atResourceCache.hpp"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <png.h>
+
+namespace at {
+std::unique_ptr<ResourceCache> ResourceCache::_instance = nullptr;
+
+ResourceCache* ResourceCache::GetInstance()
+{
+	if (_instance == nullptr) {
+		_instance.reset(new ResourceCache());
+	}
+
+	return _instance.get();
+}
+
+ResourceCache::ResourceCache()
+	: ax::event::Object(ax::App::GetInstance().GetEventManager())
+	, _running(true)
+	, _next_listener_id(0)
+{
+	AddConnection(IMAGE_READY, ax::event::Function([this](ax::event::Msg* msg) { OnImageReady(msg); }));
+	_thread = std::thread([this]() { DecodeThread(); });
+}
+
+ResourceCache::~ResourceCache()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_running = false;
+	}
+
+	_cond.notify_one();
+	_thread.join();
+}
+
+std::shared_ptr<ax::Image> ResourceCache::GetImage(const std::string& path)
+{
+	auto img_it = _images.find(path);
+
+	if (img_it != _images.end()) {
+		return img_it->second;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	if (_decoded.find(path) == _decoded.end()) {
+		auto q_it = std::find(_queue.begin(), _queue.end(), path);
+
+		// Already being decoded, waiting is cheaper than loading it again.
+		if (q_it == _queue.begin() && q_it != _queue.end()) {
+			_decoded_cond.wait(lock, [this, &path]() { return _decoded.count(path) != 0; });
+			return CreateImage(path, lock);
+		}
+
+		if (q_it != _queue.end()) {
+			_queue.erase(q_it);
+			_decoded_cond.notify_all();
+		}
+
+		lock.unlock();
+		auto img = std::make_shared<ax::Image>(path);
+		_images[path] = img;
+		return img;
+	}
+
+	return CreateImage(path, lock);
+}
+
+std::shared_ptr<ax::Image> ResourceCache::GetImageAsync(const std::string& path)
+{
+	auto img_it = _images.find(path);
+
+	if (img_it != _images.end()) {
+		return img_it->second;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	if (_decoded.find(path) == _decoded.end()) {
+		QueueDecoding(path);
+		return nullptr;
+	}
+
+	return CreateImage(path, lock);
+}
+
+int ResourceCache::AddImageListener(ImageListener listener)
+{
+	const int id = _next_listener_id++;
+	_image_listeners[id] = listener;
+	return id;
+}
+
+void ResourceCache::RemoveImageListener(int id)
+{
+	_image_listeners.erase(id);
+}
+
+void ResourceCache::Preload(const std::vector<std::string>& paths)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (auto& path : paths) {
+		if (!path.empty() && _decoded.find(path) == _decoded.end()) {
+			QueueDecoding(path);
+		}
+	}
+}
+
+void ResourceCache::WaitForPreload()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_decoded_cond.wait(lock, [this]() { return _queue.empty(); });
+}
+
+std::size_t ResourceCache::GetNumberOfPendingImages() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _queue.size();
+}
+
+std::shared_ptr<ax::Font> ResourceCache::GetFont(const std::string& path, int size)
+{
+	const std::pair<std::string, int> key(path, size);
+	auto it = _fonts.find(key);
+
+	if (it != _fonts.end()) {
+		return it->second.font;
+	}
+
+	FontEntry entry;
+	entry.font = std::make_shared<ax::Font>(path);
+
+	if (size > 0) {
+		entry.font->SetFontSize(size);
+	}
+
+	boost::system::error_code err;
+	const boost::uintmax_t file_size = boost::filesystem::file_size(path, err);
+	entry.bytes = err ? 0 : (std::size_t)file_size;
+
+	_fonts[key] = entry;
+	return entry.font;
+}
+
+void ResourceCache::ReleaseUnused()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (auto it = _images.begin(); it != _images.end();) {
+		if (it->second.use_count() == 1) {
+			_decoded.erase(it->first);
+			it = _images.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	// Preloaded pixels that were never requested.
+	for (auto it = _decoded.begin(); it != _decoded.end();) {
+		if (_images.find(it->first) == _images.end()) {
+			it = _decoded.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+
+	for (auto it = _fonts.begin(); it != _fonts.end();) {
+		if (it->second.font.use_count() == 1) {
+			it = _fonts.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+}
+
+ResourceCache::MemoryUsage ResourceCache::GetMemoryUsage() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	MemoryUsage usage;
+	usage.images = _images.size();
+	usage.fonts = _fonts.size();
+
+	for (auto& n : _decoded) {
+		usage.image_bytes += n.second.data.size();
+	}
+
+	// Images loaded directly from file.
+	for (auto& n : _images) {
+		if (_decoded.find(n.first) == _decoded.end()) {
+			const ax::Size size(n.second->GetSize());
+			usage.image_bytes += (std::size_t)size.w * (std::size_t)size.h * 4;
+		}
+	}
+
+	for (auto& n : _fonts) {
+		usage.font_bytes += n.second.bytes;
+	}
+
+	return usage;
+}
+
+void ResourceCache::QueueDecoding(const std::string& path)
+{
+	if (std::find(_queue.begin(), _queue.end(), path) == _queue.end()) {
+		_queue.push_back(path);
+		_cond.notify_one();
+	}
+}
+
+std::shared_ptr<ax::Image> ResourceCache::CreateImage(
+	const std::string& path, std::unique_lock<std::mutex>& lock)
+{
+	auto it = _decoded.find(path);
+	std::shared_ptr<ax::Image> img;
+
+	// Image object is created on the ui thread, pixels stay alive with it.
+	if (it->second.valid) {
+		img = std::make_shared<ax::Image>((void*)it->second.data.data(), it->second.size);
+	}
+	else {
+		_decoded.erase(it);
+		lock.unlock();
+		img = std::make_shared<ax::Image>(path);
+	}
+
+	_images[path] = img;
+	return img;
+}
+
+void ResourceCache::DecodeThread()
+{
+	while (true) {
+		std::string path;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait(lock, [this]() { return !_running || !_queue.empty(); });
+
+			if (!_running) {
+				return;
+			}
+
+			path = _queue.front();
+		}
+
+		Pixels pixels;
+		pixels.valid = DecodePng(path, pixels);
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_queue.pop_front();
+			_decoded[path] = std::move(pixels);
+		}
+
+		_decoded_cond.notify_all();
+		PushEvent(IMAGE_READY, new ax::event::StringMsg(path));
+	}
+}
+
+void ResourceCache::OnImageReady(ax::event::Msg* msg)
+{
+	const std::string path(static_cast<ax::event::StringMsg*>(msg)->GetMsg());
+
+	// Listeners can be removed while being called, only call the ones still registered.
+	std::vector<int> ids;
+
+	for (auto& n : _image_listeners) {
+		ids.push_back(n.first);
+	}
+
+	for (auto& id : ids) {
+		auto it = _image_listeners.find(id);
+
+		if (it != _image_listeners.end()) {
+			ImageListener listener(it->second);
+			listener(path);
+		}
+	}
+}
+
+bool ResourceCache::DecodePng(const std::string& path, Pixels& pixels)
+{
+	if (boost::filesystem::path(path).extension() != ".png") {
+		return false;
+	}
+
+	png_image image;
+	std::memset(&image, 0, sizeof(png_image));
+	image.version = PNG_IMAGE_VERSION;
+
+	if (!png_image_begin_read_from_file(&image, path.c_str())) {
+		return false;
+	}
+
+	image.format = PNG_FORMAT_RGBA;
+	pixels.data.resize(PNG_IMAGE_SIZE(image));
+
+	if (!png_image_finish_read(&image, nullptr, pixels.data.data(), 0, nullptr)) {
+		png_image_free(&image);
+		pixels.data.clear();
+		return false;
+	}
+
+	pixels.size = ax::Size(image.width, image.height);
+	return true;
+}
+}
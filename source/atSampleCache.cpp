@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "atSampleCache.hpp"
+#include "project/atAssetStore.hpp"
+#include <axlib/Util.hpp>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sndfile.h>
+
+namespace at {
+namespace {
+	/// libsndfile virtual io over a memory buffer.
+	struct MemoryFile {
+		const char* data;
+		sf_count_t size;
+		sf_count_t pos;
+	};
+
+	sf_count_t MemoryGetFileLength(void* user_data)
+	{
+		return static_cast<MemoryFile*>(user_data)->size;
+	}
+
+	sf_count_t MemorySeek(sf_count_t offset, int whence, void* user_data)
+	{
+		MemoryFile* file = static_cast<MemoryFile*>(user_data);
+		sf_count_t pos = offset;
+
+		if (whence == SEEK_CUR) {
+			pos = file->pos + offset;
+		}
+		else if (whence == SEEK_END) {
+			pos = file->size + offset;
+		}
+
+		if (pos < 0 || pos > file->size) {
+			return -1;
+		}
+
+		file->pos = pos;
+		return pos;
+	}
+
+	sf_count_t MemoryRead(void* ptr, sf_count_t count, void* user_data)
+	{
+		MemoryFile* file = static_cast<MemoryFile*>(user_data);
+		const sf_count_t n = std::min(count, file->size - file->pos);
+
+		if (n <= 0) {
+			return 0;
+		}
+
+		std::memcpy(ptr, file->data + file->pos, (std::size_t)n);
+		file->pos += n;
+		return n;
+	}
+
+	sf_count_t MemoryWrite(const void* ptr, sf_count_t count, void* user_data)
+	{
+		return 0;
+	}
+
+	sf_count_t MemoryTell(void* user_data)
+	{
+		return static_cast<MemoryFile*>(user_data)->pos;
+	}
+}
+
+std::unique_ptr<SampleCache> SampleCache::_instance = nullptr;
+
+SampleCache* SampleCache::GetInstance()
+{
+	// Called from the ui thread and from python threads.
+	static std::once_flag instance_flag;
+	std::call_once(instance_flag, []() { _instance.reset(new SampleCache()); });
+	return _instance.get();
+}
+
+SampleCache::SampleCache()
+	: _memory_usage(0)
+{
+}
+
+SampleCache::Ptr SampleCache::Load(const std::string& path)
+{
+	boost::system::error_code err;
+	const std::time_t mtime = boost::filesystem::last_write_time(path, err);
+
+	if (err) {
+		ax::console::Error("Sample", path, "doesn't exist.");
+		return nullptr;
+	}
+
+	const std::uintmax_t size = boost::filesystem::file_size(path, err);
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _file_stamps.find(path);
+
+		// Unchanged file doesn't need to be read again.
+		if (it != _file_stamps.end() && it->second.mtime == mtime && it->second.size == size) {
+			Ptr sample = Find(it->second.hash);
+
+			if (sample) {
+				return sample;
+			}
+		}
+	}
+
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file.is_open()) {
+		ax::console::Error("Can't open sample", path);
+		return nullptr;
+	}
+
+	const std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	const std::string hash = AssetIndex::HashContent(content.data(), content.size());
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	Ptr sample = Find(hash);
+
+	if (!sample) {
+		sample = Insert(path, hash, content);
+	}
+
+	if (sample) {
+		_file_stamps[path] = FileStamp{ mtime, size, hash };
+	}
+
+	return sample;
+}
+
+std::vector<SampleCache::Ptr> SampleCache::GetUsedSamples() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<Ptr> samples;
+
+	for (auto& n : _entries) {
+		if (n.second.sample.use_count() > 1) {
+			samples.push_back(n.second.sample);
+		}
+	}
+
+	return samples;
+}
+
+SampleCache::Ptr SampleCache::Find(const std::string& hash)
+{
+	auto it = _entries.find(hash);
+
+	if (it == _entries.end()) {
+		return nullptr;
+	}
+
+	// Move to front of lru list.
+	_lru.splice(_lru.begin(), _lru, it->second.lru_it);
+	return it->second.sample;
+}
+
+SampleCache::Ptr SampleCache::Insert(
+	const std::string& name, const std::string& hash, const std::vector<char>& content)
+{
+	MemoryFile mem_file = { content.data(), (sf_count_t)content.size(), 0 };
+	SF_VIRTUAL_IO io = { MemoryGetFileLength, MemorySeek, MemoryRead, MemoryWrite, MemoryTell };
+	SF_INFO info;
+	std::memset(&info, 0, sizeof(SF_INFO));
+
+	SNDFILE* snd_file = sf_open_virtual(&io, SFM_READ, &info, &mem_file);
+
+	if (snd_file == nullptr) {
+		ax::console::Error("Can't decode sample", name, ":", sf_strerror(nullptr));
+		return nullptr;
+	}
+
+	auto sample = std::make_shared<Sample>();
+	sample->hash = hash;
+	sample->channels = info.channels;
+	sample->sample_rate = info.samplerate;
+	sample->data.resize((std::size_t)(info.frames * info.channels));
+	sample->frames = (std::size_t)sf_readf_float(snd_file, sample->data.data(), info.frames);
+	sample->data.resize(sample->frames * info.channels);
+	sf_close(snd_file);
+
+	_lru.push_front(hash);
+	_entries[hash] = Entry{ sample, _lru.begin() };
+	_memory_usage += sample->data.size() * sizeof(float);
+
+	Evict();
+	return sample;
+}
+
+void SampleCache::Evict()
+{
+	auto it = _lru.end();
+
+	while (_memory_usage > MEMORY_BUDGET && it != _lru.begin()) {
+		--it;
+		auto e_it = _entries.find(*it);
+
+		// Samples still in use are never evicted.
+		if (e_it->second.sample.use_count() > 1) {
+			continue;
+		}
+
+		_memory_usage -= e_it->second.sample->data.size() * sizeof(float);
+		_entries.erase(e_it);
+		it = _lru.erase(it);
+	}
+
+	PruneFileStamps();
+}
+
+void SampleCache::PruneFileStamps()
+{
+	for (auto it = _file_stamps.begin(); it != _file_stamps.end();) {
+		if (_entries.find(it->second.hash) == _entries.end()) {
+			it = _file_stamps.erase(it);
+			continue;
+		}
+
+		++it;
+	}
+}
+}
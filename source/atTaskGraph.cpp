@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "atTaskGraph.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace at {
+namespace {
+	double GetElapsedMs(const std::chrono::steady_clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+TaskGraph::Id TaskGraph::Add(
+	const std::string& name, std::function<void()> fct, const std::vector<Id>& dependencies)
+{
+	Task task;
+	task.name = name;
+	task.fct = fct;
+
+	// Only previously added tasks, graph can't have cycles.
+	for (auto& n : dependencies) {
+		if (n < _tasks.size()) {
+			task.dependencies.push_back(n);
+		}
+	}
+
+	_tasks.push_back(task);
+	return _tasks.size() - 1;
+}
+
+void TaskGraph::Run(int n_threads, Observer observer)
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<Id> ready;
+	std::vector<std::size_t> n_waiting(_tasks.size());
+	std::vector<std::vector<Id>> dependents(_tasks.size());
+	std::size_t n_done = 0;
+
+	for (Id i = 0; i < _tasks.size(); i++) {
+		n_waiting[i] = _tasks[i].dependencies.size();
+
+		for (auto& n : _tasks[i].dependencies) {
+			dependents[n].push_back(i);
+		}
+
+		if (n_waiting[i] == 0) {
+			ready.push_back(i);
+		}
+	}
+
+	auto worker = [&]() {
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (true) {
+			cond.wait(lock, [&]() { return !ready.empty() || n_done == _tasks.size(); });
+
+			if (ready.empty()) {
+				return;
+			}
+
+			Task& task = _tasks[ready.front()];
+			const Id id = ready.front();
+			const std::size_t n_done_before = n_done;
+			ready.pop_front();
+			lock.unlock();
+
+			if (observer) {
+				observer(task, false, n_done_before);
+			}
+
+			task.start_ms = GetElapsedMs(start);
+
+			if (task.fct) {
+				task.fct();
+			}
+
+			task.duration_ms = GetElapsedMs(start) - task.start_ms;
+
+			lock.lock();
+			const std::size_t n_done_after = ++n_done;
+
+			for (auto& n : dependents[id]) {
+				if (--n_waiting[n] == 0) {
+					ready.push_back(n);
+				}
+			}
+
+			cond.notify_all();
+			lock.unlock();
+
+			if (observer) {
+				observer(task, true, n_done_after);
+			}
+
+			lock.lock();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	const int n_workers = std::max(1, std::min(n_threads, (int)_tasks.size()));
+
+	for (int i = 0; i < n_workers; i++) {
+		threads.push_back(std::thread(worker));
+	}
+
+	for (auto& t : threads) {
+		t.join();
+	}
+
+	_total_ms = GetElapsedMs(start);
+}
+}
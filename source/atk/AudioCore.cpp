@@ -1,6 +1,7 @@
 #include "atk/AudioCore.hpp"
 #include <axlib/Util.hpp>
 #include <iostream>
+#include <mutex>
 
 namespace atk {
 AudioCore::AudioCore()
@@ -17,9 +18,17 @@ AudioCore::~AudioCore()
 	delete[] _output_buffer;
 }
 
+PaError AudioCore::InitHost()
+{
+	static std::once_flag init_flag;
+	static PaError init_err = paNoError;
+	std::call_once(init_flag, []() { init_err = Pa_Initialize(); });
+	return init_err;
+}
+
 int AudioCore::InitAudio()
 {
-	err = Pa_Initialize();
+	err = InitHost();
 
 	if (err != paNoError) {
 		std::cerr << "Error." << std::endl;
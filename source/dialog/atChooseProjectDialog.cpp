@@ -25,6 +25,7 @@
 #include "dialog/atChooseProjectDialog.hpp"
 
 #include "atMainWindowProjectHandler.h"
+#include "dialog/atProjectBrowser.hpp"
 #include "editor/atEditorMainWindow.hpp"
 #include <axlib/WindowManager.hpp>
 
@@ -63,6 +64,11 @@ ChooseProjectDialog::ChooseProjectDialog(const ax::Rect& rect)
 	auto debug_btn = ax::shared<ax::Button>(
 		ax::Rect(btn_pos, btn_size), GetOnDebugProject(), btn_info, "", "Debug project");
 	win->node.Add(debug_btn);
+
+	// Recent projects.
+	auto browser = ax::shared<at::ProjectBrowser>(ax::Rect(50, 290, rect.size.w - 100, 140), "atproj");
+	browser->GetWindow()->AddConnection(at::ProjectBrowser::OPEN, GetOnOpenRecentProject());
+	win->node.Add(browser);
 }
 
 std::shared_ptr<at::editor::MainWindow> ChooseProjectDialog::CreateMainWindow()
@@ -100,7 +106,16 @@ void ChooseProjectDialog::OnCreateProject(const ax::Button::Msg& msg)
 
 void ChooseProjectDialog::OnOpenProject(const ax::Button::Msg& msg)
 {
-	const std::string project_path = ax::App::GetInstance().OpenFileDialog();
+	OpenProject(ax::App::GetInstance().OpenFileDialog());
+}
+
+void ChooseProjectDialog::OnOpenRecentProject(const ax::event::StringMsg& msg)
+{
+	OpenProject(msg.GetMsg());
+}
+
+void ChooseProjectDialog::OpenProject(const std::string& project_path)
+{
 	if (!at::editor::MainWindowProjectHandler::IsProjectPathValid(project_path)) {
 		return;
 	}
@@ -44,55 +44,18 @@ namespace editor {
 		//		win->event.GrabGlobalMouse();
 		//		ax::App::GetInstance().GetPopupManager()->AddGlobalClickListener(win);
 
-		ax::DropMenu::Info menu_info;
-		menu_info.normal = ax::Color(240, 240, 240);
-		menu_info.hover = ax::Color(246, 246, 246);
-		menu_info.font_color = ax::Color(0.0);
-		menu_info.selected = ax::Color(41, 222, 255);
-		menu_info.selected_hover = ax::Color(41, 226, 255);
-		menu_info.selected_font_color = ax::Color(0.0);
-		menu_info.contour = ax::Color(0.86);
-		menu_info.separation = ax::Color(0.86);
-		menu_info.up_down_arrow = ax::Color(0.35);
-		menu_info.right_arrow = ax::Color(0.70);
-		menu_info.item_height = 35;
-
-		ax::os::Path dir("layouts/");
-		//		ax::os::Directory dir;
-		//		dir.Goto("layouts/");
-
-		//		std::vector<ax::os::File> files = dir.GetContent();
-		std::vector<ax::os::Path> files = dir.GetDirectoryContent();
-
-		std::vector<std::string> layout_files;
-
-		for (auto& n : files) {
-			//		ax::console::Print(n.name);
-			//			if (n.ext == "xml") {
-			if (n.GetExtension() == "xml") {
-				layout_files.push_back(n.GetAbsolutePath());
-			}
-		}
-
-		for (auto& n : layout_files) {
-			ax::console::Print(n);
-		}
-
-		//	ax::Size fsize(ax::App::GetInstance().GetFrameSize());
-		ax::Size size(at::editor::MainWindow::WIDGET_MENU_WIDTH, rect.size.h);
-
-		_menu = ax::shared<ax::DropMenu>(
-			ax::Rect(ax::Point(0, 0), size), GetOnMenuSelection(), menu_info, layout_files);
-
-		win->node.Add(_menu);
+		// Layouts from project index (layouts/ folder).
+		ax::Size size(at::editor::MainWindow::WIDGET_MENU_WIDTH, rect.size.h - 30);
 
-		ax::Size menu_size(_menu->GetWindow()->dimension.GetSize());
+		_browser = ax::shared<at::ProjectBrowser>(ax::Rect(ax::Point(0, 0), size), "xml");
+		_browser->GetWindow()->AddConnection(at::ProjectBrowser::OPEN, GetOnBrowserOpen());
+		win->node.Add(_browser);
 
-		auto open = ax::shared<ax::Button>(ax::Rect(rect.position.x, menu_size.h, size.w * 0.5, 30),
-			GetOnOpen(), ax::Button::Info(), "", "Open");
+		auto open = ax::shared<ax::Button>(
+			ax::Rect(rect.position.x, size.h, size.w * 0.5, 30), GetOnOpen(), ax::Button::Info(), "", "Open");
 
 		auto cancel = ax::shared<ax::Button>(
-			ax::Rect(ax::Point(size.w * 0.5, menu_size.h), ax::Size(size.w * 0.5, 30)), GetOnCancel(),
+			ax::Rect(ax::Point(size.w * 0.5, size.h), ax::Size(size.w * 0.5, 30)), GetOnCancel(),
 			ax::Button::Info(), "", "Cancel");
 
 		win->node.Add(open);
@@ -148,7 +111,7 @@ namespace editor {
 	{
 		//		std::string label = _txtBox->GetLabel();
 		//		ax::console::Print(label);
-		win->PushEvent(OPEN, new ax::event::StringMsg(_menu->GetSelectedItem()));
+		win->PushEvent(OPEN, new ax::event::StringMsg(_browser->GetSelectedPath()));
 		DeleteDialog();
 	}
 
@@ -158,9 +121,9 @@ namespace editor {
 		DeleteDialog();
 	}
 
-	void OpenDialog::OnMenuSelection(const ax::DropMenu::Msg& msg)
+	void OpenDialog::OnBrowserOpen(const ax::event::StringMsg& msg)
 	{
-		win->PushEvent(OPEN, new ax::event::StringMsg(msg.GetItem()));
+		win->PushEvent(OPEN, new ax::event::StringMsg(msg.GetMsg()));
 		DeleteDialog();
 	}
 
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "dialog/atProjectBrowser.hpp"
+#include "atResourceCache.hpp"
+#include <algorithm>
+
+namespace at {
+ProjectBrowser::ProjectBrowser(const ax::Rect& rect, const std::string& extension)
+	: _extension(extension)
+	, _font(0)
+	, _font_info(0)
+	, _selected(-1)
+	, _scroll_offset(0)
+{
+	_font_info.SetFontSize(10);
+
+	win = ax::Window::Create(rect);
+	win->event.OnPaint = ax::WBind<ax::GC>(this, &ProjectBrowser::OnPaint);
+	win->event.OnMouseEnter = ax::WBind<ax::Point>(this, &ProjectBrowser::OnMouseEnter);
+	win->event.OnMouseLeave = ax::WBind<ax::Point>(this, &ProjectBrowser::OnMouseLeave);
+	win->event.OnScrollWheel = ax::WBind<ax::Point>(this, &ProjectBrowser::OnScrollWheel);
+	win->event.OnMouseLeftDown = ax::WBind<ax::Point>(this, &ProjectBrowser::OnMouseLeftDown);
+	win->event.OnMouseLeftDoubleClick = ax::WBind<ax::Point>(this, &ProjectBrowser::OnMouseLeftDoubleClick);
+
+	// Show last saved index right away, refresh in background.
+	UpdateEntries();
+
+	_index_listener_id = ProjectIndex::GetInstance()->AddUpdateListener([this]() {
+		UpdateEntries();
+		win->Update();
+	});
+
+	ProjectIndex::GetInstance()->Refresh();
+}
+
+ProjectBrowser::~ProjectBrowser()
+{
+	ProjectIndex::GetInstance()->RemoveUpdateListener(_index_listener_id);
+}
+
+std::string ProjectBrowser::GetSelectedPath() const
+{
+	if (_selected < 0 || _selected >= (int)_entries.size()) {
+		return "";
+	}
+
+	return _entries[_selected].path;
+}
+
+void ProjectBrowser::UpdateEntries()
+{
+	const std::string selected_path(GetSelectedPath());
+	_entries = ProjectIndex::GetInstance()->GetEntries(_extension);
+	_selected = -1;
+
+	for (int i = 0; i < (int)_entries.size(); i++) {
+		if (_entries[i].path == selected_path) {
+			_selected = i;
+			break;
+		}
+	}
+
+	const int max_offset = std::max(0, (int)_entries.size() * ROW_HEIGHT - win->dimension.GetSize().h);
+	_scroll_offset = ax::util::Clamp<int>(_scroll_offset, 0, max_offset);
+}
+
+int ProjectBrowser::GetRowIndex(const ax::Point& pos) const
+{
+	const ax::Point m_pos(pos - win->dimension.GetAbsoluteRect().position);
+	const int index = (m_pos.y + _scroll_offset) / ROW_HEIGHT;
+
+	if (m_pos.y < 0 || index >= (int)_entries.size()) {
+		return -1;
+	}
+
+	return index;
+}
+
+void ProjectBrowser::OnMouseEnter(const ax::Point& pos)
+{
+	win->event.GrabScroll();
+}
+
+void ProjectBrowser::OnMouseLeave(const ax::Point& pos)
+{
+	if (!win->dimension.GetAbsoluteRect().IsPointInside(pos)) {
+		win->event.UnGrabScroll();
+	}
+}
+
+void ProjectBrowser::OnScrollWheel(const ax::Point& delta)
+{
+	const int max_offset = std::max(0, (int)_entries.size() * ROW_HEIGHT - win->dimension.GetSize().h);
+	const int offset = ax::util::Clamp<int>(_scroll_offset + delta.y, 0, max_offset);
+
+	if (offset != _scroll_offset) {
+		_scroll_offset = offset;
+		win->Update();
+	}
+}
+
+void ProjectBrowser::OnMouseLeftDown(const ax::Point& pos)
+{
+	const int index = GetRowIndex(pos);
+
+	if (index == -1 || index == _selected) {
+		return;
+	}
+
+	_selected = index;
+	win->PushEvent(SELECT, new ax::event::StringMsg(_entries[index].path));
+	win->Update();
+}
+
+void ProjectBrowser::OnMouseLeftDoubleClick(const ax::Point& pos)
+{
+	const int index = GetRowIndex(pos);
+
+	if (index == -1) {
+		return;
+	}
+
+	_selected = index;
+	win->PushEvent(OPEN, new ax::event::StringMsg(_entries[index].path));
+}
+
+void ProjectBrowser::OnPaint(ax::GC gc)
+{
+	const ax::Rect rect(win->dimension.GetDrawingRect());
+
+	gc.SetColor(ax::Color(1.0));
+	gc.DrawRectangle(rect);
+
+	if (_entries.empty()) {
+		gc.SetColor(ax::Color(0.4));
+		const std::string msg(ProjectIndex::GetInstance()->IsRefreshing() ? "Loading ..." : "No project.");
+		gc.DrawStringAlignedCenter(_font, msg, rect);
+		gc.SetColor(ax::Color(0.7));
+		gc.DrawRectangleContour(rect);
+		return;
+	}
+
+	// Only draw visible rows.
+	const int first = _scroll_offset / ROW_HEIGHT;
+	const int last = std::min((int)_entries.size(), (_scroll_offset + rect.size.h) / ROW_HEIGHT + 1);
+
+	for (int i = first; i < last; i++) {
+		const ProjectIndex::Entry& entry = _entries[i];
+		const ax::Rect row(0, i * ROW_HEIGHT - _scroll_offset, rect.size.w, ROW_HEIGHT);
+
+		gc.SetColor(i == _selected ? ax::Color(41, 222, 255) : (i % 2 ? ax::Color(0.97) : ax::Color(1.0)));
+		gc.DrawRectangle(row);
+
+		int txt_x = 5;
+
+		if (!entry.thumbnail.empty()) {
+			auto it = _thumbnails.find(entry.thumbnail);
+
+			if (it == _thumbnails.end()) {
+				auto img = ResourceCache::GetInstance()->GetImage(entry.thumbnail);
+				it = _thumbnails.emplace(entry.thumbnail, img).first;
+			}
+
+			if (it->second->IsImageReady()) {
+				gc.DrawImageResize(it->second.get(), row.position + ax::Point(3, 3),
+					ax::Size(ROW_HEIGHT - 6, ROW_HEIGHT - 6));
+			}
+
+			txt_x = ROW_HEIGHT + 2;
+		}
+
+		gc.SetColor(ax::Color(0.0));
+		gc.DrawString(_font, entry.name, row.position + ax::Point(txt_x, 2));
+
+		gc.SetColor(ax::Color(0.4));
+		const std::string info(std::to_string(entry.widget_count) + " widgets, script "
+			+ std::to_string(entry.script_size / 1024) + " kB");
+		gc.DrawString(_font_info, info, row.position + ax::Point(txt_x, 19));
+	}
+
+	gc.SetColor(ax::Color(0.7));
+	gc.DrawRectangleContour(rect);
+}
+}
@@ -47,49 +47,28 @@ namespace editor {
 		_gwin->_is_snap_active = active;
 	}
 
-	ax::Point GridSnapProxy::FindClosestPosition(const ax::Point& pos) const
+	bool GridSnapProxy::IsSmartGuideActive() const
 	{
-		const int grid_space = _gwin->_grid_space;
-		int x = -1;
-		int y = -1;
-
-		// Find x position.
-		if (pos.x < grid_space) {
-			x = 0;
-		}
-		else {
-			const std::vector<ax::FPoint>& vertical_lines = _gwin->_vertical_lines_array;
-			for (int i = 0; i < vertical_lines.size() - 2; i += 2) {
-				if (pos.x >= vertical_lines[i].x && pos.x < vertical_lines[i + 2].x) {
-					x = vertical_lines[i].x;
-					break;
-				}
-			}
+		return _gwin->_is_smart_guide_active;
+	}
 
-			if (x == -1) {
-				x = vertical_lines[vertical_lines.size() - 1].x;
-			}
-		}
+	void GridSnapProxy::SetSmartGuide(bool active)
+	{
+		_gwin->_is_smart_guide_active = active;
 
-		// Find y position.
-		if (pos.y < grid_space) {
-			y = 0;
+		if (!active) {
+			_gwin->ClearGuides();
 		}
-		else {
-			const std::vector<ax::FPoint>& horizontal_lines = _gwin->_horizontal_lines_array;
-			for (int i = 0; i < horizontal_lines.size() - 2; i += 2) {
-				if (pos.y >= horizontal_lines[i].y && pos.y < horizontal_lines[i + 2].y) {
-					y = horizontal_lines[i].y;
-					break;
-				}
-			}
+	}
 
-			if (y == -1) {
-				y = horizontal_lines[horizontal_lines.size() - 1].y;
-			}
-		}
+	ax::Point GridSnapProxy::FindClosestPosition(const ax::Point& pos) const
+	{
+		return _gwin->FindClosestGridPosition(pos);
+	}
 
-		return ax::Point(x, y);
+	ax::Point GridSnapProxy::FindGuidePosition(ax::Window* widget, const ax::Rect& rect) const
+	{
+		return _gwin->FindGuidePosition(widget, rect);
 	}
 
 	void GridSnapProxy::SetGridSpace(int space)
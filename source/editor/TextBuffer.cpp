@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextBuffer.hpp"
+#include <algorithm>
+
+TextBuffer::TextBuffer()
+	: _n_lines(0)
+	, _n_chars(0)
+	, _last_block(0)
+{
+	SetLines(std::vector<std::string>());
+}
+
+void TextBuffer::SetLines(const std::vector<std::string>& lines)
+{
+	for (auto& n : _listeners) {
+		n->OnLinesErased(0, _n_lines);
+		n->OnLinesInserted(0, 1);
+	}
+
+	_blocks.clear();
+	_blocks.push_back(Block(1, std::string("")));
+	_block_start.assign(1, 0);
+	_n_lines = 1;
+	_n_chars = 0;
+	_last_block = 0;
+	Modified();
+
+	if (!lines.empty()) {
+		InsertLines(0, lines);
+		EraseLines(lines.size(), lines.size() + 1);
+	}
+}
+
+std::shared_ptr<const std::string> TextBuffer::GetText() const
+{
+	if (_snapshot == nullptr) {
+		std::shared_ptr<std::string> text = std::make_shared<std::string>();
+		text->reserve(_n_chars + _n_lines);
+
+		for (auto& block : _blocks) {
+			for (auto& line : block) {
+				text->append(line);
+				text->push_back('\n');
+			}
+		}
+
+		_snapshot = text;
+	}
+
+	return _snapshot;
+}
+
+const std::string& TextBuffer::GetLine(std::size_t index) const
+{
+	const std::size_t b = FindBlock(index);
+	return _blocks[b][index - _block_start[b]];
+}
+
+std::string& TextBuffer::GetMutableLine(std::size_t index)
+{
+	const std::size_t b = FindBlock(index);
+	Modified();
+
+	for (auto& n : _listeners) {
+		n->OnLineChanged(index);
+	}
+
+	return _blocks[b][index - _block_start[b]];
+}
+
+void TextBuffer::Insert(std::size_t line, std::size_t x, const std::string& str)
+{
+	GetMutableLine(line).insert(x, str);
+	_n_chars += str.size();
+}
+
+void TextBuffer::Erase(std::size_t line, std::size_t x, std::size_t n)
+{
+	std::string& l = GetMutableLine(line);
+	n = std::min(n, l.size() - x);
+	l.erase(x, n);
+	_n_chars -= n;
+}
+
+void TextBuffer::Append(std::size_t line, const std::string& str)
+{
+	GetMutableLine(line).append(str);
+	_n_chars += str.size();
+}
+
+void TextBuffer::SplitLine(std::size_t line, std::size_t x)
+{
+	std::string& l = GetMutableLine(line);
+	std::string right = l.substr(x);
+	l.erase(x);
+	_n_chars -= right.size();
+
+	InsertLines(line + 1, std::vector<std::string>(1, right));
+}
+
+void TextBuffer::JoinLine(std::size_t line)
+{
+	if (line + 1 >= _n_lines) {
+		return;
+	}
+
+	std::string next = GetLine(line + 1);
+	EraseLines(line + 1, line + 2);
+	Append(line, next);
+}
+
+void TextBuffer::InsertLines(std::size_t index, const std::vector<std::string>& lines)
+{
+	if (lines.empty()) {
+		return;
+	}
+
+	// Appending goes at the end of the last block.
+	const std::size_t b = index >= _n_lines ? _blocks.size() - 1 : FindBlock(index);
+	const std::size_t offset = std::min(index, _n_lines) - _block_start[b];
+
+	Block& block = _blocks[b];
+	block.insert(block.begin() + offset, lines.begin(), lines.end());
+
+	for (auto& n : lines) {
+		_n_chars += n.size();
+	}
+
+	Modified();
+
+	if (block.size() > MAX_BLOCK_SIZE) {
+		SplitBlock(b);
+	}
+
+	UpdateBlockStart(b);
+
+	for (auto& n : _listeners) {
+		n->OnLinesInserted(std::min(index, _n_lines - lines.size()), lines.size());
+	}
+}
+
+void TextBuffer::EraseLines(std::size_t first, std::size_t last)
+{
+	last = std::min(last, _n_lines);
+
+	if (first >= last) {
+		return;
+	}
+
+	const std::size_t first_block = FindBlock(first);
+	std::size_t b = first_block;
+	std::size_t offset = first - _block_start[b];
+	std::size_t remaining = last - first;
+
+	while (remaining > 0 && b < _blocks.size()) {
+		Block& block = _blocks[b];
+		const std::size_t n = std::min(remaining, block.size() - offset);
+
+		for (std::size_t i = offset; i < offset + n; i++) {
+			_n_chars -= block[i].size();
+		}
+
+		block.erase(block.begin() + offset, block.begin() + offset + n);
+		remaining -= n;
+		offset = 0;
+
+		if (block.empty()) {
+			_blocks.erase(_blocks.begin() + b);
+		}
+		else {
+			b++;
+		}
+	}
+
+	for (auto& n : _listeners) {
+		n->OnLinesErased(first, last);
+	}
+
+	// Buffer always has at least one line.
+	if (_blocks.empty()) {
+		_blocks.push_back(Block(1, std::string("")));
+
+		for (auto& n : _listeners) {
+			n->OnLinesInserted(0, 1);
+		}
+	}
+
+	Modified();
+	UpdateBlockStart(std::min(first_block, _blocks.size() - 1));
+}
+
+std::size_t TextBuffer::FindBlock(std::size_t line) const
+{
+	if (_last_block < _blocks.size() && line >= _block_start[_last_block]
+		&& line < _block_start[_last_block] + _blocks[_last_block].size()) {
+		return _last_block;
+	}
+
+	auto it = std::upper_bound(_block_start.begin(), _block_start.end(), line);
+	_last_block = std::max<std::ptrdiff_t>(0, (it - _block_start.begin()) - 1);
+	return _last_block;
+}
+
+void TextBuffer::SplitBlock(std::size_t block)
+{
+	const std::size_t half = MAX_BLOCK_SIZE / 2;
+	Block lines;
+	lines.swap(_blocks[block]);
+
+	std::vector<Block> chunks;
+	chunks.reserve(lines.size() / half + 1);
+
+	for (std::size_t i = 0; i < lines.size(); i += half) {
+		const std::size_t end = std::min(lines.size(), i + half);
+		chunks.push_back(Block(std::make_move_iterator(lines.begin() + i),
+			std::make_move_iterator(lines.begin() + end)));
+	}
+
+	_blocks[block].swap(chunks[0]);
+	_blocks.insert(_blocks.begin() + block + 1, std::make_move_iterator(chunks.begin() + 1),
+		std::make_move_iterator(chunks.end()));
+}
+
+void TextBuffer::UpdateBlockStart(std::size_t block)
+{
+	_block_start.resize(_blocks.size());
+
+	for (std::size_t i = block; i < _blocks.size(); i++) {
+		_block_start[i] = i == 0 ? 0 : _block_start[i - 1] + _blocks[i - 1].size();
+	}
+
+	_n_lines = _block_start.back() + _blocks.back().size();
+	_last_block = block;
+}
@@ -24,6 +24,7 @@
 
 #include "editor/TextEditor.hpp"
 #include <algorithm>
+#include <cctype>
 
 /*******************************************************************************
  * eos::TextEditor.
@@ -31,12 +32,43 @@
 TextEditor::TextEditor(const ax::Rect& rect, const TextEditor::Info& info)
 	: _font("fonts/VeraMono.ttf")
 	, _line_num_font("fonts/DejaVuSansMono.ttf")
+	, _linter(_logic.GetFileData())
 	, _info(info)
 	, _line_height(15)
 	, _file_start_index(0)
 
 {
 	_line_num_font.SetFontSize(10);
+	_char_advance.fill(-1);
+
+	_token_colors[TextEditorHighlighter::TEXT] = _info.text_color;
+	_token_colors[TextEditorHighlighter::KEYWORD] = ax::Color(170, 13, 145);
+	_token_colors[TextEditorHighlighter::BUILTIN] = ax::Color(92, 38, 153);
+	_token_colors[TextEditorHighlighter::PYO_CLASS] = ax::Color(63, 110, 116);
+	_token_colors[TextEditorHighlighter::NUMBER] = ax::Color(28, 0, 207);
+	_token_colors[TextEditorHighlighter::STRING] = ax::Color(180, 10, 10);
+	_token_colors[TextEditorHighlighter::COMMENT] = ax::Color(0.6);
+	_token_colors[TextEditorHighlighter::OPERATOR] = ax::Color(222, 69, 199);
+	_token_colors[TextEditorHighlighter::DELIMITER] = ax::Color(0, 0, 255);
+
+	// Highlighter follows every modification of the text.
+	_logic.AddBufferListener(&_highlighter);
+	_highlighter.Reset(_logic.GetFileData().GetLineCount());
+
+	// Script is compiled in background when typing pauses.
+	_logic.AddBufferListener(&_linter);
+	_linter.AddConnection(TextEditorLinter::DIAGNOSTIC_CHANGE,
+		ax::event::Function([this](ax::event::Msg* msg) { _scrollPanel->Update(); }));
+
+	// Build or load completion index before the first keystroke.
+	TextEditorCompletion::GetInstance();
+	_logic.AddBufferListener(&_buffer_words);
+	_buffer_words.Reset(_logic.GetFileData().GetLineCount());
+
+	// Char positions are kept per line until the line is modified.
+	_logic.AddBufferListener(this);
+	_line_positions.assign(_logic.GetFileData().GetLineCount(), std::vector<int>());
+
 	_n_line_shown = (rect.size.h - 1) / _line_height;
 
 	win = ax::Window::Create(rect);
@@ -92,7 +124,7 @@ TextEditor::TextEditor(const ax::Rect& rect, const TextEditor::Info& info)
 	win->node.Add(scroll_bar);
 
 	// Scrollbar is use without window handle, it behave just like a slider.
-	int h_size = (int)_logic.GetFileData().size() * _line_height;
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
 	_scrollBar->UpdateWindowSize(ax::Size(rect.size.w, h_size));
 }
 
@@ -113,7 +145,7 @@ bool TextEditor::OpenFile(const std::string& path)
 	ax::Rect rect = win->dimension.GetRect();
 
 	// Scrollbar is use without window handle, it behave just like a slider.
-	int h_size = (int)_logic.GetFileData().size() * _line_height;
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
 	_scrollBar->UpdateWindowSize(ax::Size(rect.size.w, h_size));
 	win->Update();
 	_scrollPanel->Update();
@@ -121,16 +153,160 @@ bool TextEditor::OpenFile(const std::string& path)
 	return err;
 }
 
-std::string TextEditor::GetStringContent() const
+bool TextEditor::SetSearchPattern(const std::string& pattern, bool regex)
+{
+	TextEditorSearch& search = _logic.GetSearch();
+
+	if (search.GetPattern() == pattern && search.IsActive()) {
+		return true;
+	}
+
+	return search.SetPattern(pattern, regex);
+}
+
+bool TextEditor::Find(const std::string& pattern, bool regex)
+{
+	if (!SetSearchPattern(pattern, regex)) {
+		return false;
+	}
+
+	bool found = _logic.FindNext();
+	MoveToCursorPosition();
+	_scrollPanel->Update();
+	return found;
+}
+
+bool TextEditor::Replace(const std::string& pattern, const std::string& replacement, bool regex)
+{
+	if (!SetSearchPattern(pattern, regex)) {
+		return false;
+	}
+
+	bool found = _logic.ReplaceNext(replacement);
+	OnTextChanged();
+	return found;
+}
+
+int TextEditor::ReplaceAll(const std::string& pattern, const std::string& replacement, bool regex)
+{
+	if (!SetSearchPattern(pattern, regex)) {
+		return 0;
+	}
+
+	int n = _logic.ReplaceAll(replacement);
+	OnTextChanged();
+	return n;
+}
+
+void TextEditor::OnTextChanged()
+{
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
+	_scrollBar->UpdateWindowSize(ax::Size(_scrollPanel->dimension.GetRect().size.w, h_size));
+	MoveToCursorPosition();
+	_scrollPanel->Update();
+}
+
+bool TextEditor::HasSyntaxError(int& line, std::string& msg) const
+{
+	const TextEditorLinter::Diagnostic& diagnostic = _linter.GetDiagnostic();
+
+	if (!_linter.IsUpToDate() || diagnostic.valid) {
+		return false;
+	}
+
+	line = diagnostic.line;
+	msg = diagnostic.msg;
+	return true;
+}
+
+std::string TextEditor::GetWordBeforeCursor() const
+{
+	const ax::Point cur_pos(_logic.GetCursorPosition());
+	const std::string& text = _logic.GetFileData().GetLine(cur_pos.y);
+
+	int begin = std::min(cur_pos.x, (int)text.size());
+
+	while (begin > 0 && (std::isalnum((unsigned char)text[begin - 1]) || text[begin - 1] == '_')) {
+		begin--;
+	}
+
+	// Identifiers can't start with a digit.
+	if (begin < cur_pos.x && std::isdigit((unsigned char)text[begin])) {
+		return "";
+	}
+
+	return text.substr(begin, cur_pos.x - begin);
+}
+
+void TextEditor::UpdateCompletion()
 {
-	std::string content;
-	const std::vector<std::string>& data = _logic.GetFileData();
+	const std::string prefix = GetWordBeforeCursor();
+
+	if (prefix.size() < 2) {
+		CloseCompletion();
+		return;
+	}
+
+	std::vector<const SymbolTrie::Symbol*> symbols;
+	std::vector<const SymbolTrie::Symbol*> words;
+	TextEditorCompletion::GetInstance()->GetSymbols().Find(prefix, MAX_COMPLETIONS + 1, symbols);
+	_buffer_words.Find(_logic.GetFileData(), prefix, MAX_COMPLETIONS + 1, words);
+
+	_completions.clear();
+
+	for (auto& n : symbols) {
+		if (_completions.size() < MAX_COMPLETIONS && n->name != prefix) {
+			_completions.push_back(n);
+		}
+	}
 
-	for (auto& n : data) {
-		content += (n + "\n");
+	for (auto& n : words) {
+		if (_completions.size() == MAX_COMPLETIONS || n->name == prefix) {
+			continue;
+		}
+
+		auto it = std::find_if(_completions.begin(), _completions.end(),
+			[&n](const SymbolTrie::Symbol* s) { return s->name == n->name; });
+
+		if (it == _completions.end()) {
+			_completions.push_back(n);
+		}
+	}
+
+	if (prefix != _completion_prefix) {
+		_completion_index = 0;
+		_completion_picked = false;
+		_completion_prefix = prefix;
 	}
 
-	return content;
+	_completion_index = std::min(_completion_index, std::max(0, (int)_completions.size() - 1));
+}
+
+void TextEditor::CloseCompletion()
+{
+	_completions.clear();
+	_completion_prefix.clear();
+	_completion_index = 0;
+	_completion_picked = false;
+}
+
+void TextEditor::AcceptCompletion()
+{
+	const std::string& name = _completions[_completion_index]->name;
+	const std::string suffix = name.substr(_completion_prefix.size());
+	CloseCompletion();
+
+	if (!suffix.empty()) {
+		_logic.InsertText(suffix);
+	}
+
+	OnTextChanged();
+}
+
+std::string TextEditor::GetStringContent() const
+{
+	// Snapshot is only rebuilt after the text was modified.
+	return *_logic.GetFileData().GetText();
 }
 
 std::string TextEditor::GetFilePath() const
@@ -189,7 +365,7 @@ void TextEditor::MoveToCursorPosition()
 	}
 
 	// Move scroll bar.
-	int diff = (int)_logic.GetFileData().size() - _n_line_shown;
+	int diff = (int)_logic.GetFileData().GetLineCount() - _n_line_shown;
 
 	if (diff < 0) {
 		_scrollBar->SetZeroToOneValue(0.0);
@@ -203,7 +379,7 @@ void TextEditor::MoveToCursorPosition()
 
 void TextEditor::OnResize(const ax::Size& size)
 {
-	const int file_size((int)_logic.GetFileData().size());
+	const int file_size((int)_logic.GetFileData().GetLineCount());
 	//	double r = (_file_start_index / double(file_size));
 
 	_n_line_shown = size.h / _line_height;
@@ -232,7 +408,7 @@ void TextEditor::OnResize(const ax::Size& size)
 
 void TextEditor::OnScroll(const ax::ScrollBar::Msg& msg)
 {
-	int diff = (int)_logic.GetFileData().size() - _n_line_shown;
+	int diff = (int)_logic.GetFileData().GetLineCount() - _n_line_shown;
 
 	if (diff < 0) {
 		diff = 0;
@@ -274,6 +450,7 @@ void TextEditor::OnMouseLeaveChild(const ax::Point& pos)
 
 void TextEditor::OnLeftArrowDown(const char& key)
 {
+	CloseCompletion();
 	_logic.MoveCursorLeft();
 	MoveToCursorPosition();
 	_scrollPanel->Update();
@@ -281,6 +458,7 @@ void TextEditor::OnLeftArrowDown(const char& key)
 
 void TextEditor::OnRightArrowDown(const char& key)
 {
+	CloseCompletion();
 	_logic.MoveCursorRight();
 	MoveToCursorPosition();
 	_scrollPanel->Update();
@@ -288,6 +466,14 @@ void TextEditor::OnRightArrowDown(const char& key)
 
 void TextEditor::OnUpArrowDown(const char& key)
 {
+	if (!_completions.empty()) {
+		const int n = (int)_completions.size();
+		_completion_index = _completion_picked ? (_completion_index + n - 1) % n : n - 1;
+		_completion_picked = true;
+		_scrollPanel->Update();
+		return;
+	}
+
 	_logic.MoveCursorUp();
 	MoveToCursorPosition();
 	_scrollPanel->Update();
@@ -295,6 +481,13 @@ void TextEditor::OnUpArrowDown(const char& key)
 
 void TextEditor::OnDownArrowDown(const char& key)
 {
+	if (!_completions.empty()) {
+		_completion_index = _completion_picked ? (_completion_index + 1) % (int)_completions.size() : 0;
+		_completion_picked = true;
+		_scrollPanel->Update();
+		return;
+	}
+
 	_logic.MoveCursorDown();
 	MoveToCursorPosition();
 	_scrollPanel->Update();
@@ -310,18 +503,8 @@ void TextEditor::OnKeyDown(const char& key)
 			ax::util::String::ReplaceCharWithString(content, '\t', "    ");
 
 			if (!content.empty()) {
-				std::vector<std::string>& file_data = _logic.GetFileData();
-				ax::Point cur_pos(_logic.GetCursorPosition());
-
-				std::vector<std::string> paste_content(ax::util::String::Split(content, "\n"));
-
-				file_data[cur_pos.y].insert(cur_pos.x, paste_content[0]);
-
-				for (int i = 1; i < paste_content.size(); i++) {
-					file_data.insert(file_data.begin() + cur_pos.y + i, paste_content[i]);
-				}
-
-				_scrollPanel->Update();
+				_logic.InsertText(content);
+				OnTextChanged();
 			}
 		}
 		else if (key == 'a' || key == 'A') {
@@ -332,9 +515,24 @@ void TextEditor::OnKeyDown(const char& key)
 			std::string str = _logic.GetSelectedContent();
 			ax::App::GetInstance().SetPasteboardContent(str);
 		}
+		else if (key == 'z' || key == 'Z' || key == 'y' || key == 'Y') {
+			// Shift + z or y redo.
+			const bool done = key == 'z' ? _logic.Undo() : _logic.Redo();
+
+			if (done) {
+				OnTextChanged();
+			}
+		}
+	}
+	else if (key == ESCAPE_KEY) {
+		if (!_completions.empty()) {
+			CloseCompletion();
+			_scrollPanel->Update();
+		}
 	}
 	else {
 		_logic.AddChar(key);
+		UpdateCompletion();
 		MoveToCursorPosition();
 		_scrollPanel->Update();
 	}
@@ -342,9 +540,15 @@ void TextEditor::OnKeyDown(const char& key)
 
 void TextEditor::OnEnterDown(const char& key)
 {
+	if (_completion_picked && !_completions.empty()) {
+		AcceptCompletion();
+		return;
+	}
+
+	CloseCompletion();
 	_logic.Enter();
 
-	int h_size = (int)_logic.GetFileData().size() * _line_height;
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
 	_scrollBar->UpdateWindowSize(ax::Size(_scrollPanel->dimension.GetRect().size.w, h_size));
 	MoveToCursorPosition();
 
@@ -354,7 +558,12 @@ void TextEditor::OnEnterDown(const char& key)
 void TextEditor::OnBackSpaceDown(const char& key)
 {
 	_logic.BackSpace();
-	int h_size = (int)_logic.GetFileData().size() * _line_height;
+
+	if (!_completions.empty()) {
+		UpdateCompletion();
+	}
+
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
 	_scrollBar->UpdateWindowSize(ax::Size(_scrollPanel->dimension.GetRect().size.w, h_size));
 	MoveToCursorPosition();
 
@@ -363,8 +572,9 @@ void TextEditor::OnBackSpaceDown(const char& key)
 
 void TextEditor::OnKeyDeleteDown(const char& key)
 {
+	CloseCompletion();
 	_logic.Delete();
-	int h_size = (int)_logic.GetFileData().size() * _line_height;
+	int h_size = (int)_logic.GetFileData().GetLineCount() * _line_height;
 	_scrollBar->UpdateWindowSize(ax::Size(_scrollPanel->dimension.GetRect().size.w, h_size));
 	MoveToCursorPosition();
 
@@ -395,67 +605,98 @@ ax::Point TextEditor::GetCursorPositionFromMousePos(const ax::Point& m_pos)
 	// Calculate line index.
 	const int line_index = _file_start_index + m_pos.y / _line_height;
 
-	const std::vector<std::string>& data = _logic.GetFileData();
+	const TextBuffer& data = _logic.GetFileData();
 
 	// Click bellow text, go to last char.
-	if (line_index >= data.size()) {
-		return ax::Point((int)data[data.size() - 1].size(), (int)data.size() - 1);
+	if (line_index >= data.GetLineCount()) {
+		const int last_line = (int)data.GetLineCount() - 1;
+		return ax::Point(data.GetLineLength(last_line), last_line);
 	}
 
 	// Selected line data.
-	const std::string& text = data[line_index];
+	const std::string& text = data.GetLine(line_index);
 
-	// Store all characters width from line.
-	std::vector<int> next_vec;
-	next_vec.reserve(text.size() + 1);
+	// Line is empty.
+	// Set cursor to begnning of line.
+	if (text.empty()) {
+		return ax::Point(0, line_index);
+	}
 
 	/// @todo Change 25 for a constant.
-	next_vec.push_back(25 + 4);
+	const int x = m_pos.x - (25 + 4);
+	const std::vector<int>& next_vec = GetLinePositions(line_index);
+
+	// Closest char boundary to mouse position.
+	auto it = std::lower_bound(next_vec.begin(), next_vec.end(), x);
 
-	// For all char in line.
-	for (int i = 0; i < text.size(); i++) {
-		_font.SetChar(text[i]);
-		next_vec.push_back(_font.GetNextPosition());
+	if (it == next_vec.end()) {
+		return ax::Point((int)text.size(), line_index);
 	}
 
-	// Line is empty.
-	// Set cursor to begnning of line.
-	if (next_vec.size() <= 1) {
-		return ax::Point(0, line_index);
+	int cursor_index_x = int(it - next_vec.begin());
+
+	if (cursor_index_x > 0 && x - next_vec[cursor_index_x - 1] < *it - x) {
+		cursor_index_x--;
 	}
 
-	// Find char index in line.
-	int cursor_index_x = -1;
+	return ax::Point(cursor_index_x, line_index);
+}
+
+int TextEditor::GetCharAdvance(char c)
+{
+	int& advance = _char_advance[(unsigned char)c];
 
-	// First char in line.
-	if (m_pos.x >= next_vec[0] && m_pos.x < next_vec[0] + 0.30 * next_vec[1]) {
-		cursor_index_x = 0;
+	if (advance < 0) {
+		_font.SetChar(c);
+		advance = _font.GetNextPosition();
 	}
-	else {
-		int sum_size_x = next_vec[0];
-
-		for (int i = 1; i < next_vec.size() - 1; i++) {
-			int left = sum_size_x + 0.5 * next_vec[i];
-			int right = sum_size_x + next_vec[i] + 0.5 * next_vec[i + 1];
-			if (m_pos.x >= left && m_pos.x < right) {
-				cursor_index_x = i;
-				break;
-			}
-			sum_size_x += next_vec[i];
-		}
+
+	return advance;
+}
+
+const std::vector<int>& TextEditor::GetLinePositions(std::size_t line)
+{
+	const TextBuffer& data = _logic.GetFileData();
+
+	if (_line_positions.size() != data.GetLineCount()) {
+		_line_positions.assign(data.GetLineCount(), std::vector<int>());
 	}
 
-	// Char is not found.
-	// Goto to last char for line.
-	if (cursor_index_x == -1) {
-		return ax::Point((int)text.size(), line_index);
+	// Valid positions always contain at least the first boundary.
+	std::vector<int>& positions = _line_positions[line];
+
+	if (positions.empty()) {
+		const std::string& text = data.GetLine(line);
+		positions.assign(text.size() + 1, 0);
+
+		for (int i = 0; i < text.size(); i++) {
+			positions[i + 1] = positions[i] + GetCharAdvance(text[i]);
+		}
 	}
 
-	if (cursor_index_x < _logic.GetFileData()[line_index].size()) {
-		return ax::Point(cursor_index_x, line_index);
+	return positions;
+}
+
+void TextEditor::OnLineChanged(std::size_t line)
+{
+	if (line < _line_positions.size()) {
+		_line_positions[line].clear();
 	}
+}
 
-	return ax::Point(-1, -1);
+void TextEditor::OnLinesInserted(std::size_t index, std::size_t count)
+{
+	index = std::min(index, _line_positions.size());
+	_line_positions.insert(_line_positions.begin() + index, count, std::vector<int>());
+}
+
+void TextEditor::OnLinesErased(std::size_t first, std::size_t last)
+{
+	last = std::min(last, _line_positions.size());
+
+	if (first < last) {
+		_line_positions.erase(_line_positions.begin() + first, _line_positions.begin() + last);
+	}
 }
 
 void TextEditor::OnMouseLeftDown(const ax::Point& pos)
@@ -473,6 +714,7 @@ void TextEditor::OnMouseLeftDown(const ax::Point& pos)
 		return;
 	}
 
+	CloseCompletion();
 	_logic.SetCursorPosition(cur_position);
 	_logic.UnselectRectangle();
 	_logic.BeginSelectCursor();
@@ -569,6 +811,15 @@ void TextEditor::OnPaint(ax::GC gc)
 
 	ax::Point num_pos(4, 2);
 
+	// Syntax error gutter marker.
+	const TextEditorLinter::Diagnostic& diagnostic = _linter.GetDiagnostic();
+	const int error_line = diagnostic.valid ? -1 : diagnostic.line - _file_start_index;
+
+	if (error_line >= 0 && error_line < _n_line_shown) {
+		gc.SetColor(ax::Color(1.0f, 0.0f, 0.0f, 0.3f));
+		gc.DrawRectangle(ax::Rect(0, error_line * _line_height, 25, _line_height));
+	}
+
 	gc.SetColor(_info.line_number_color);
 
 	// Draw line number.
@@ -593,75 +844,55 @@ void TextEditor::OnPaint(ax::GC gc)
 
 	_next_pos_data.clear();
 
-	const std::vector<std::string>& data = _logic.GetFileData();
+	const TextBuffer& data = _logic.GetFileData();
 
 	// For all shown line in text.
-	for (int i = 0, k = _file_start_index; k < data.size() && i < _n_line_shown; i++, k++) {
+	for (int i = 0, k = _file_start_index; k < data.GetLineCount() && i < _n_line_shown; i++, k++) {
 		// Line.
-		const std::string& text = data[k];
-		std::vector<int> next_vec(text.size() + 1);
+		const std::string& text = data.GetLine(k);
+		std::vector<int> next_vec(text.size() + 1, line_pos.x);
 
 		// Draw string.
 		if (_font) {
-			int x = line_pos.x;
+			const std::vector<int>& positions = GetLinePositions(k);
 
-			next_vec[0] = x;
+			for (int i = 0; i < positions.size(); i++) {
+				next_vec[i] = line_pos.x + positions[i];
+			}
 
-			// Set text color.
-			gc.SetColor(_info.text_color);
+			// Search matches.
+			if (_logic.GetSearch().IsActive()) {
+				gc.SetColor(ax::Color(1.0f, 0.86f, 0.0f, 0.4f));
 
-			bool line_comment = false;
-			bool string_literal = false;
-			bool last_char_str_literal = false;
+				for (auto& n : _logic.GetSearch().GetLineMatches(data, k)) {
+					const int width = next_vec[n.end] - next_vec[n.begin];
+					gc.DrawRectangle(ax::Rect(next_vec[n.begin], line_pos.y, width, _line_height));
+				}
+			}
 
-			// For all char in line.
-			for (int i = 0; i < text.size(); i++) {
+			// Tokens with the same type are drawn with a single string.
+			const std::vector<TextEditorHighlighter::Token>& tokens = _highlighter.GetTokens(data, k);
 
-				if (text[i] == '#') {
-					line_comment = true;
-				}
-				else if (text[i] == '\"') {
-					string_literal = !string_literal;
-					last_char_str_literal = true;
-				}
+			for (int t = 0; t < tokens.size();) {
+				const int begin = tokens[t].begin;
+				const TextEditorHighlighter::TokenType type = tokens[t].type;
+				int end = tokens[t].end;
 
-				if (!line_comment) {
-					if (string_literal || last_char_str_literal) {
-						gc.SetColor(ax::Color(180, 10, 10));
-					}
-					else {
-						if (text[i] == '=') {
-							gc.SetColor(ax::Color(222, 69, 199));
-						}
-						else if (text[i] == ':') {
-							gc.SetColor(ax::Color(0, 0, 255));
-						}
-						else if (text[i] == ';') {
-							gc.SetColor(ax::Color(0, 0, 255));
-						}
-						else if (text[i] == '(' || text[i] == ')') {
-							gc.SetColor(ax::Color(222, 69, 199));
-						}
-						else if (text[i] == '.') {
-							gc.SetColor(ax::Color(0, 0, 255));
-						}
-						else {
-							gc.SetColor(_info.text_color);
-						}
-					}
-
-					last_char_str_literal = false;
-				}
-				else {
-					gc.SetColor(ax::Color(0.6));
+				for (t++; t < tokens.size() && tokens[t].type == type; t++) {
+					end = tokens[t].end;
 				}
 
-				// Draw char.
-				x = gc.DrawChar(_font, text[i], ax::Point(x, line_pos.y)).x;
-				next_vec[i + 1] = x;
+				gc.SetColor(_token_colors[type]);
+				gc.DrawString(_font, text.substr(begin, end - begin), ax::Point(next_vec[begin], line_pos.y));
 			}
 		}
 
+		// Syntax error message after line content.
+		if (i == error_line) {
+			gc.SetColor(ax::Color(1.0f, 0.0f, 0.0f, 0.6f));
+			gc.DrawString(_font, "  # " + diagnostic.msg, ax::Point(next_vec.back(), line_pos.y));
+		}
+
 		_next_pos_data.push_back(next_vec);
 		line_pos += ax::Point(0, 15);
 	}
@@ -679,6 +910,10 @@ void TextEditor::OnPaint(ax::GC gc)
 
 				gc.SetColor(_info.cursor_color);
 				gc.DrawLine(ax::Point(x, y), ax::Point(x, y + _line_height));
+
+				if (!_completions.empty()) {
+					DrawCompletion(gc, ax::Point(x, y + _line_height));
+				}
 			}
 		}
 	}
@@ -760,3 +995,61 @@ void TextEditor::OnPaint(ax::GC gc)
 		}
 	}
 }
+
+void TextEditor::DrawCompletion(ax::GC& gc, const ax::Point& cursor_pos)
+{
+	const ax::Rect rect(_scrollPanel->dimension.GetDrawingRect());
+	const int n_rows = (int)_completions.size();
+	const int brief_height = _completions[_completion_index]->brief.empty() ? 0 : _line_height;
+	const int height = n_rows * _line_height + brief_height;
+
+	ax::Point pos(cursor_pos.x - (int)_completion_prefix.size() * GetCharAdvance('a'), cursor_pos.y);
+	pos.x = std::max(25, std::min(pos.x, rect.size.w - COMPLETION_WIDTH - 10));
+
+	// Show above cursor line when there's no room bellow.
+	if (pos.y + height > rect.size.h) {
+		pos.y = std::max(0, cursor_pos.y - _line_height - height);
+	}
+
+	const ax::Rect popup_rect(pos, ax::Size(COMPLETION_WIDTH, height));
+	gc.SetColor(ax::Color(0.97));
+	gc.DrawRectangle(popup_rect);
+
+	if (_completion_picked) {
+		gc.SetColor(ax::Color(0.6f, 0.75f, 0.95f, 0.6f));
+		const int selected_y = pos.y + _completion_index * _line_height;
+		gc.DrawRectangle(ax::Rect(pos.x, selected_y, COMPLETION_WIDTH, _line_height));
+	}
+
+	for (int i = 0; i < n_rows; i++) {
+		const SymbolTrie::Symbol* symbol = _completions[i];
+
+		if (symbol->kind == SymbolTrie::PYO_CLASS) {
+			gc.SetColor(_token_colors[TextEditorHighlighter::PYO_CLASS]);
+		}
+		else if (symbol->kind == SymbolTrie::BUFFER_WORD) {
+			gc.SetColor(_info.text_color);
+		}
+		else {
+			gc.SetColor(_token_colors[TextEditorHighlighter::BUILTIN]);
+		}
+
+		gc.DrawString(_font, symbol->name, ax::Point(pos.x + 4, pos.y + i * _line_height));
+	}
+
+	// Brief of selected symbol.
+	if (brief_height) {
+		const int max_chars = (COMPLETION_WIDTH - 8) / std::max(1, GetCharAdvance('a'));
+		std::string brief = _completions[_completion_index]->brief;
+
+		if ((int)brief.size() > max_chars) {
+			brief = brief.substr(0, std::max(0, max_chars - 3)) + "...";
+		}
+
+		gc.SetColor(ax::Color(0.5));
+		gc.DrawString(_font, brief, ax::Point(pos.x + 4, pos.y + n_rows * _line_height));
+	}
+
+	gc.SetColor(ax::Color(0.7));
+	gc.DrawRectangleContour(popup_rect);
+}
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextEditorCompletion.hpp"
+#include "editor/atEditorPyDoc.hpp"
+#include "project/atAssetStore.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+// Bump when the completion.index format changes.
+const int INDEX_VERSION = 2;
+
+// Shorter buffer words aren't worth completing.
+const std::size_t MIN_WORD_LENGTH = 3;
+
+// PyoObject methods.
+const std::vector<std::string> pyo_methods = { "play", "stop", "out", "mix", "range", "get", "set", "ctrl",
+	"setMul", "setAdd", "setSub", "setDiv", "isPlaying", "isOutputting", "setStopDelay", "boot", "start",
+	"shutdown", "gui", "amp", "recstart", "recstop" };
+
+// Classes and methods exported by the ax module (see source/python).
+const std::vector<std::string> ax_wrappers = { "Widgets", "Window", "Panel", "Button", "Knob", "NumberBox",
+	"Sprite", "Sample", "GC", "Point", "Size", "Rect", "Color", "Get", "GetWindow", "GetWidgetByName",
+	"GetPosition", "SetPosition", "GetSize", "SetSize", "GetDrawingRect", "Update", "GetValue", "SetValue",
+	"GetIndex", "SetIndex", "SetColor", "SetBackgroundColor", "SetContourColor", "DrawRectangle",
+	"DrawRectangleContour", "OpenFileDialog", "LoadSample", "GetBuffer", "GetChannels", "GetFrames",
+	"GetSampleRate", "GetHash", "IsValid" };
+}
+
+/*******************************************************************************
+ * SymbolTrie.
+ ******************************************************************************/
+SymbolTrie::SymbolTrie()
+{
+	_root.symbol = -1;
+}
+
+void SymbolTrie::Insert(const std::string& word, Kind kind, const std::string& brief)
+{
+	if (word.empty()) {
+		return;
+	}
+
+	Node* node = &_root;
+	std::size_t pos = 0;
+
+	while (true) {
+		if (pos == word.size()) {
+			if (node->symbol == -1) {
+				node->symbol = (int)_symbols.size();
+				_symbols.push_back(Symbol{ word, kind, brief });
+			}
+
+			return;
+		}
+
+		// Children are sorted by first char.
+		auto it = std::lower_bound(node->children.begin(), node->children.end(), word[pos],
+			[](const std::unique_ptr<Node>& n, char c) { return n->label[0] < c; });
+
+		if (it == node->children.end() || (*it)->label[0] != word[pos]) {
+			std::unique_ptr<Node> leaf(new Node());
+			leaf->label = word.substr(pos);
+			leaf->symbol = (int)_symbols.size();
+			_symbols.push_back(Symbol{ word, kind, brief });
+			node->children.insert(it, std::move(leaf));
+			return;
+		}
+
+		Node* child = it->get();
+		std::size_t common = 0;
+
+		while (common < child->label.size() && pos + common < word.size()
+			&& child->label[common] == word[pos + common]) {
+			common++;
+		}
+
+		// Split edge.
+		if (common < child->label.size()) {
+			std::unique_ptr<Node> split(new Node());
+			split->label = child->label.substr(0, common);
+			split->symbol = -1;
+			child->label = child->label.substr(common);
+			split->children.push_back(std::move(*it));
+			*it = std::move(split);
+			child = it->get();
+		}
+
+		node = child;
+		pos += common;
+	}
+}
+
+void SymbolTrie::Find(
+	const std::string& prefix, std::size_t max_results, std::vector<const Symbol*>& results) const
+{
+	const Node* node = &_root;
+	std::size_t pos = 0;
+
+	while (pos < prefix.size()) {
+		auto it = std::lower_bound(node->children.begin(), node->children.end(), prefix[pos],
+			[](const std::unique_ptr<Node>& n, char c) { return n->label[0] < c; });
+
+		if (it == node->children.end() || (*it)->label[0] != prefix[pos]) {
+			return;
+		}
+
+		const std::string& label = (*it)->label;
+		const std::size_t n = std::min(label.size(), prefix.size() - pos);
+
+		if (label.compare(0, n, prefix, pos, n) != 0) {
+			return;
+		}
+
+		node = it->get();
+		pos += n;
+	}
+
+	Collect(node, max_results, results);
+}
+
+void SymbolTrie::Collect(const Node* node, std::size_t max_results, std::vector<const Symbol*>& results) const
+{
+	if (results.size() >= max_results) {
+		return;
+	}
+
+	if (node->symbol != -1) {
+		results.push_back(&_symbols[node->symbol]);
+	}
+
+	for (auto& n : node->children) {
+		Collect(n.get(), max_results, results);
+	}
+}
+
+void SymbolTrie::Clear()
+{
+	_root.children.clear();
+	_root.symbol = -1;
+	_symbols.clear();
+}
+
+/*******************************************************************************
+ * TextEditorBufferWords.
+ ******************************************************************************/
+TextEditorBufferWords::TextEditorBufferWords()
+	: _trie_valid(true)
+{
+	Reset(1);
+}
+
+void TextEditorBufferWords::Reset(std::size_t n_lines)
+{
+	_lines.assign(n_lines, Line{ false, std::vector<std::string>() });
+	_word_count.clear();
+	_trie.Clear();
+	_trie_valid = true;
+}
+
+void TextEditorBufferWords::Find(const TextBuffer& buffer, const std::string& prefix, std::size_t max_results,
+	std::vector<const SymbolTrie::Symbol*>& results)
+{
+	Update(buffer);
+
+	if (!_trie_valid) {
+		_trie.Clear();
+
+		for (auto& n : _word_count) {
+			_trie.Insert(n.first, SymbolTrie::BUFFER_WORD);
+		}
+
+		_trie_valid = true;
+	}
+
+	_trie.Find(prefix, max_results, results);
+}
+
+void TextEditorBufferWords::Update(const TextBuffer& buffer)
+{
+	if (_lines.size() != buffer.GetLineCount()) {
+		Reset(buffer.GetLineCount());
+	}
+
+	for (std::size_t k = 0; k < _lines.size(); k++) {
+		Line& line = _lines[k];
+
+		if (line.valid) {
+			continue;
+		}
+
+		const std::string& text = buffer.GetLine(k);
+		std::size_t i = 0;
+
+		while (i < text.size()) {
+			if (!std::isalpha((unsigned char)text[i]) && text[i] != '_') {
+				i++;
+				continue;
+			}
+
+			std::size_t end = i + 1;
+
+			while (end < text.size() && (std::isalnum((unsigned char)text[end]) || text[end] == '_')) {
+				end++;
+			}
+
+			if (end - i >= MIN_WORD_LENGTH) {
+				line.words.push_back(text.substr(i, end - i));
+
+				if (_word_count[line.words.back()]++ == 0) {
+					_trie_valid = false;
+				}
+			}
+
+			i = end;
+		}
+
+		line.valid = true;
+	}
+}
+
+void TextEditorBufferWords::ForgetWords(Line& line)
+{
+	for (auto& n : line.words) {
+		auto it = _word_count.find(n);
+
+		if (it != _word_count.end() && --it->second == 0) {
+			_word_count.erase(it);
+			_trie_valid = false;
+		}
+	}
+
+	line.words.clear();
+	line.valid = false;
+}
+
+void TextEditorBufferWords::OnLineChanged(std::size_t line)
+{
+	if (line < _lines.size()) {
+		ForgetWords(_lines[line]);
+	}
+}
+
+void TextEditorBufferWords::OnLinesInserted(std::size_t index, std::size_t count)
+{
+	index = std::min(index, _lines.size());
+	_lines.insert(_lines.begin() + index, count, Line{ false, std::vector<std::string>() });
+}
+
+void TextEditorBufferWords::OnLinesErased(std::size_t first, std::size_t last)
+{
+	last = std::min(last, _lines.size());
+
+	if (first >= last) {
+		return;
+	}
+
+	for (std::size_t i = first; i < last; i++) {
+		ForgetWords(_lines[i]);
+	}
+
+	_lines.erase(_lines.begin() + first, _lines.begin() + last);
+}
+
+/*******************************************************************************
+ * TextEditorCompletion.
+ ******************************************************************************/
+std::unique_ptr<TextEditorCompletion> TextEditorCompletion::_instance = nullptr;
+
+TextEditorCompletion* TextEditorCompletion::GetInstance()
+{
+	if (_instance == nullptr) {
+		_instance.reset(new TextEditorCompletion());
+	}
+
+	return _instance.get();
+}
+
+TextEditorCompletion::TextEditorCompletion()
+	: _index_path("completion.index")
+{
+	if (!Load()) {
+		Rebuild();
+		Save();
+	}
+}
+
+void TextEditorCompletion::Rebuild()
+{
+	_symbols.Clear();
+
+	// Pyo classes with their brief from pyo documentation.
+	for (auto& category : at::editor::PyDoc::GetClassCategories()) {
+		for (auto& n : category.second) {
+			_symbols.Insert(n, SymbolTrie::PYO_CLASS, at::editor::PyDoc::GetClassBrief(n));
+		}
+	}
+
+	for (auto& n : pyo_methods) {
+		_symbols.Insert(n, SymbolTrie::PYO_METHOD);
+	}
+
+	for (auto& n : ax_wrappers) {
+		_symbols.Insert(n, SymbolTrie::AX_WRAPPER);
+	}
+}
+
+std::string TextEditorCompletion::GetInputHash()
+{
+	std::string input;
+
+	for (auto& category : at::editor::PyDoc::GetClassCategories()) {
+		for (auto& n : category.second) {
+			input += n + '\n';
+		}
+	}
+
+	for (auto& n : pyo_methods) {
+		input += n + '\n';
+	}
+
+	for (auto& n : ax_wrappers) {
+		input += n + '\n';
+	}
+
+	return at::AssetIndex::HashContent(input.data(), input.size());
+}
+
+bool TextEditorCompletion::Load()
+{
+	std::ifstream file(_index_path);
+
+	if (!file.is_open()) {
+		return false;
+	}
+
+	// Header is "version\thash", then one "kind\tname\tbrief" per line.
+	std::string line;
+
+	if (!std::getline(file, line) || line != std::to_string(INDEX_VERSION) + '\t' + GetInputHash()) {
+		return false;
+	}
+
+	while (std::getline(file, line)) {
+		const std::size_t t0 = line.find('\t');
+		const std::size_t t1 = line.find('\t', t0 == std::string::npos ? 0 : t0 + 1);
+
+		if (t0 == std::string::npos || t1 == std::string::npos) {
+			_symbols.Clear();
+			return false;
+		}
+
+		const int kind = std::atoi(line.substr(0, t0).c_str());
+		_symbols.Insert(line.substr(t0 + 1, t1 - t0 - 1), (SymbolTrie::Kind)kind, line.substr(t1 + 1));
+	}
+
+	return !_symbols.GetSymbols().empty();
+}
+
+bool TextEditorCompletion::Save()
+{
+	std::ofstream file(_index_path);
+
+	if (!file.is_open()) {
+		return false;
+	}
+
+	file << INDEX_VERSION << '\t' << GetInputHash() << '\n';
+
+	for (auto& n : _symbols.GetSymbols()) {
+		std::string brief(n.brief);
+		std::replace(brief.begin(), brief.end(), '\n', ' ');
+		std::replace(brief.begin(), brief.end(), '\t', ' ');
+		file << (int)n.kind << '\t' << n.name << '\t' << brief << '\n';
+	}
+
+	return true;
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextEditorHighlighter.hpp"
+#include "editor/atEditorPyDoc.hpp"
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <vector>
+
+namespace {
+const std::set<std::string> python_keywords = { "and", "as", "assert", "break", "class", "continue", "def",
+	"del", "elif", "else", "except", "exec", "finally", "for", "from", "global", "if", "import", "in", "is",
+	"lambda", "not", "or", "pass", "print", "raise", "return", "try", "while", "with", "yield" };
+
+const std::set<std::string> python_builtins = { "True", "False", "None", "self", "abs", "all", "any",
+	"dict", "enumerate", "float", "int", "len", "list", "max", "min", "object", "open", "range", "round",
+	"set", "str", "sum", "tuple", "type", "xrange", "zip" };
+
+// Pyo classes used in scripts that aren't in the documentation categories.
+const std::vector<std::string> undocumented_pyo_classes = { "Server", "Osc", "OscLoop", "TableRead",
+	"SndTable", "HarmTable", "HannTable", "LinTable", "CosTable", "ExpTable", "CurveTable", "NewTable",
+	"DataTable", "Metro", "Pattern", "CallAfter", "Trig", "Change", "Thresh", "Mix", "Pan", "SPan",
+	"Selector", "Switch", "Granulator", "Looper", "Record", "Notein", "Midictl", "MToF", "Randi", "Randh",
+	"Choice", "Scale" };
+
+// Documented pyo classes (see PyDoc) plus the undocumented ones above.
+const std::set<std::string>& get_pyo_classes()
+{
+	static const std::set<std::string> classes = []() {
+		std::set<std::string> names(undocumented_pyo_classes.begin(), undocumented_pyo_classes.end());
+
+		for (auto& category : at::editor::PyDoc::GetClassCategories()) {
+			names.insert(category.second.begin(), category.second.end());
+		}
+
+		return names;
+	}();
+
+	return classes;
+}
+
+inline bool is_identifier_char(char c)
+{
+	return std::isalnum((unsigned char)c) || c == '_';
+}
+
+inline bool is_operator(char c)
+{
+	return c == '=' || c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '<' || c == '>'
+		|| c == '!' || c == '&' || c == '|' || c == '^' || c == '~' || c == '(' || c == ')' || c == '['
+		|| c == ']' || c == '{' || c == '}';
+}
+
+inline bool is_delimiter(char c)
+{
+	return c == ',' || c == ':' || c == ';' || c == '.' || c == '@';
+}
+
+// Returns index after closing quote of a single line string or end of line.
+int find_string_end(const std::string& text, int pos, char quote)
+{
+	for (std::size_t i = pos; i < text.size(); i++) {
+		if (text[i] == '\\') {
+			i++;
+		}
+		else if (text[i] == quote) {
+			return (int)i + 1;
+		}
+	}
+
+	return (int)text.size();
+}
+}
+
+TextEditorHighlighter::TextEditorHighlighter()
+	: _first_invalid(0)
+{
+	Reset(1);
+}
+
+void TextEditorHighlighter::Reset(std::size_t n_lines)
+{
+	_lines.assign(n_lines, Line{ false, NORMAL, NORMAL, std::vector<Token>() });
+	_first_invalid = 0;
+}
+
+const std::vector<TextEditorHighlighter::Token>& TextEditorHighlighter::GetTokens(
+	const TextBuffer& buffer, std::size_t line)
+{
+	Update(buffer, line);
+	return _lines[line].tokens;
+}
+
+void TextEditorHighlighter::Update(const TextBuffer& buffer, std::size_t up_to)
+{
+	if (_lines.size() != buffer.GetLineCount()) {
+		Reset(buffer.GetLineCount());
+	}
+
+	for (std::size_t k = _first_invalid; k <= up_to && k < _lines.size(); k++) {
+		const LexerState state = k == 0 ? NORMAL : _lines[k - 1].out_state;
+		Line& line = _lines[k];
+
+		// State converged, line doesn't need to be lexed again.
+		if (line.valid && line.in_state == state) {
+			continue;
+		}
+
+		line.tokens.clear();
+		line.in_state = state;
+		line.out_state = LexLine(buffer.GetLine(k), state, line.tokens);
+		line.valid = true;
+	}
+
+	_first_invalid = std::max(_first_invalid, up_to + 1);
+}
+
+TextEditorHighlighter::LexerState TextEditorHighlighter::LexLine(
+	const std::string& text, LexerState state, std::vector<Token>& tokens)
+{
+	const int size = (int)text.size();
+	int i = 0;
+
+	// Continue multi line string.
+	if (state != NORMAL) {
+		const std::string delimiter(state == TRIPLE_SINGLE_QUOTE ? "'''" : "\"\"\"");
+		std::size_t end = text.find(delimiter);
+
+		if (end == std::string::npos) {
+			tokens.push_back(Token{ 0, size, STRING });
+			return state;
+		}
+
+		i = (int)end + 3;
+		tokens.push_back(Token{ 0, i, STRING });
+		state = NORMAL;
+	}
+
+	while (i < size) {
+		const char c = text[i];
+
+		if (c == ' ' || c == '\t') {
+			i++;
+		}
+		else if (c == '#') {
+			tokens.push_back(Token{ i, size, COMMENT });
+			break;
+		}
+		else if (c == '\'' || c == '"') {
+			// Triple quoted string.
+			if (i + 2 < size && text[i + 1] == c && text[i + 2] == c) {
+				std::size_t end = text.find(std::string(3, c), i + 3);
+
+				if (end == std::string::npos) {
+					tokens.push_back(Token{ i, size, STRING });
+					return c == '\'' ? TRIPLE_SINGLE_QUOTE : TRIPLE_DOUBLE_QUOTE;
+				}
+
+				tokens.push_back(Token{ i, (int)end + 3, STRING });
+				i = (int)end + 3;
+			}
+			else {
+				const int end = find_string_end(text, i + 1, c);
+				tokens.push_back(Token{ i, end, STRING });
+				i = end;
+			}
+		}
+		else if (std::isdigit((unsigned char)c) || (c == '.' && i + 1 < size && std::isdigit(text[i + 1]))) {
+			int end = i + 1;
+
+			while (end < size && (is_identifier_char(text[end]) || text[end] == '.')) {
+				end++;
+			}
+
+			tokens.push_back(Token{ i, end, NUMBER });
+			i = end;
+		}
+		else if (is_identifier_char(c)) {
+			int end = i + 1;
+
+			while (end < size && is_identifier_char(text[end])) {
+				end++;
+			}
+
+			tokens.push_back(Token{ i, end, GetIdentifierType(text.substr(i, end - i)) });
+			i = end;
+		}
+		else {
+			const TokenType type = is_operator(c) ? OPERATOR : is_delimiter(c) ? DELIMITER : TEXT;
+			tokens.push_back(Token{ i, i + 1, type });
+			i++;
+		}
+	}
+
+	return NORMAL;
+}
+
+TextEditorHighlighter::TokenType TextEditorHighlighter::GetIdentifierType(const std::string& word)
+{
+	if (python_keywords.count(word)) {
+		return KEYWORD;
+	}
+
+	if (python_builtins.count(word)) {
+		return BUILTIN;
+	}
+
+	if (get_pyo_classes().count(word)) {
+		return PYO_CLASS;
+	}
+
+	return TEXT;
+}
+
+void TextEditorHighlighter::OnLineChanged(std::size_t line)
+{
+	if (line < _lines.size()) {
+		_lines[line].valid = false;
+	}
+
+	_first_invalid = std::min(_first_invalid, line);
+}
+
+void TextEditorHighlighter::OnLinesInserted(std::size_t index, std::size_t count)
+{
+	index = std::min(index, _lines.size());
+	_lines.insert(_lines.begin() + index, count, Line{ false, NORMAL, NORMAL, std::vector<Token>() });
+	_first_invalid = std::min(_first_invalid, index);
+}
+
+void TextEditorHighlighter::OnLinesErased(std::size_t first, std::size_t last)
+{
+	last = std::min(last, _lines.size());
+
+	if (first < last) {
+		_lines.erase(_lines.begin() + first, _lines.begin() + last);
+	}
+
+	_first_invalid = std::min(_first_invalid, first);
+}
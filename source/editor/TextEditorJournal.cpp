@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextEditorJournal.hpp"
+#include <algorithm>
+
+TextEditorJournal::TextEditorJournal()
+	: _index(0)
+	, _bytes(0)
+	, _checkpoint(0)
+	, _can_merge(false)
+{
+}
+
+void TextEditorJournal::Record(const Edit& edit, bool merge)
+{
+	// Nothing to undo (e.g. replace with an empty string).
+	if (edit.text.empty()) {
+		return;
+	}
+
+	// Drop redo history.
+	while (_entries.size() > _index) {
+		_bytes -= GetEntrySize(_entries.back());
+		_entries.pop_back();
+	}
+
+	if (_checkpoint > (int)_index) {
+		_checkpoint = -1;
+	}
+
+	_bytes += edit.text.size();
+
+	if (!_entries.empty() && _index == _entries.size()) {
+		if (merge) {
+			_entries.back().push_back(edit);
+			_can_merge = true;
+			return;
+		}
+
+		// Checkpoint has to stay between two entries.
+		if (_can_merge && _checkpoint != (int)_index && Merge(_entries.back().back(), edit)) {
+			return;
+		}
+	}
+
+	_entries.push_back(Entry(1, edit));
+	_index = _entries.size();
+	_can_merge = true;
+
+	// Drop oldest entries when history gets too big.
+	while (_entries.size() > 1 && (_entries.size() > MAX_ENTRIES || _bytes > MAX_BYTES)) {
+		_bytes -= GetEntrySize(_entries.front());
+		_entries.pop_front();
+		_index--;
+		_checkpoint = _checkpoint > 0 ? _checkpoint - 1 : -1;
+	}
+}
+
+bool TextEditorJournal::Merge(Edit& last, const Edit& edit) const
+{
+	if (last.type != edit.type || last.pos.y != edit.pos.y || edit.pos.y != edit.cursor_after.y) {
+		return false;
+	}
+
+	if (last.text.find('\n') != std::string::npos || edit.text.find('\n') != std::string::npos) {
+		return false;
+	}
+
+	if (edit.type == Edit::INSERT) {
+		// Typing continues at the end of last insert, a new word starts a new entry.
+		if (edit.pos.x != last.pos.x + (int)last.text.size()) {
+			return false;
+		}
+
+		if (edit.text[0] == ' ' && !last.text.empty() && last.text.back() != ' ') {
+			return false;
+		}
+
+		last.text += edit.text;
+	}
+	// Backspace.
+	else if (edit.pos.x + (int)edit.text.size() == last.pos.x) {
+		last.text = edit.text + last.text;
+		last.pos = edit.pos;
+	}
+	// Forward delete.
+	else if (edit.pos == last.pos) {
+		last.text += edit.text;
+	}
+	else {
+		return false;
+	}
+
+	last.cursor_after = edit.cursor_after;
+	return true;
+}
+
+const TextEditorJournal::Entry* TextEditorJournal::Undo()
+{
+	_can_merge = false;
+
+	if (_index == 0) {
+		return nullptr;
+	}
+
+	return &_entries[--_index];
+}
+
+const TextEditorJournal::Entry* TextEditorJournal::Redo()
+{
+	_can_merge = false;
+
+	if (_index == _entries.size()) {
+		return nullptr;
+	}
+
+	return &_entries[_index++];
+}
+
+void TextEditorJournal::Clear()
+{
+	_entries.clear();
+	_index = 0;
+	_bytes = 0;
+	_checkpoint = 0;
+	_can_merge = false;
+}
+
+ax::Point TextEditorJournal::GetEndPosition(const ax::Point& pos, const std::string& text)
+{
+	const std::size_t last_new_line = text.rfind('\n');
+
+	if (last_new_line == std::string::npos) {
+		return ax::Point(pos.x + (int)text.size(), pos.y);
+	}
+
+	const int n_lines = (int)std::count(text.begin(), text.end(), '\n');
+	return ax::Point(int(text.size() - last_new_line - 1), pos.y + n_lines);
+}
+
+std::size_t TextEditorJournal::GetEntrySize(const Entry& entry)
+{
+	std::size_t size = 0;
+
+	for (auto& n : entry) {
+		size += n.text.size();
+	}
+
+	return size;
+}
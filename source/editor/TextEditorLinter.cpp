@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextEditorLinter.hpp"
+#include "python/m_pyo.h"
+
+TextEditorLinter::TextEditorLinter(const TextBuffer& buffer)
+	: ax::event::Object(ax::App::GetInstance().GetEventManager())
+	, _buffer(buffer)
+	, _interp(nullptr)
+	, _checked_generation(0)
+	, _running(true)
+	, _generation(0)
+	, _requested_generation(0)
+	, _text_generation(0)
+	, _result_generation(0)
+{
+	AddConnection(CHECK_REQUEST, ax::event::Function([this](ax::event::Msg* msg) { OnCheckRequest(msg); }));
+	AddConnection(CHECK_DONE, ax::event::Function([this](ax::event::Msg* msg) { OnCheckDone(msg); }));
+	_thread = std::thread([this]() { CheckThread(); });
+}
+
+TextEditorLinter::~TextEditorLinter()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_running = false;
+	}
+
+	_cond.notify_one();
+	_thread.join();
+}
+
+void TextEditorLinter::OnLineChanged(std::size_t line)
+{
+	Touch();
+}
+
+void TextEditorLinter::OnLinesInserted(std::size_t index, std::size_t count)
+{
+	Touch();
+}
+
+void TextEditorLinter::OnLinesErased(std::size_t first, std::size_t last)
+{
+	Touch();
+}
+
+void TextEditorLinter::Touch()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_generation++;
+		_last_modification = std::chrono::steady_clock::now();
+	}
+
+	_cond.notify_one();
+}
+
+void TextEditorLinter::OnCheckRequest(ax::event::Msg* msg)
+{
+	const int generation = static_cast<ax::event::SimpleMsg<int>*>(msg)->GetMsg();
+
+	// Text was modified again since the request, a new one will come.
+	if (generation != _generation) {
+		return;
+	}
+
+	// Interpreter is created on the ui thread since python might not be initialized yet.
+	if (_interp == nullptr) {
+		_interp = pyo_new_compile_interpreter();
+	}
+
+	// Snapshot is shared with the buffer until next modification.
+	std::shared_ptr<const std::string> text = _buffer.GetText();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_text = text;
+		_text_generation = generation;
+	}
+
+	_cond.notify_one();
+}
+
+void TextEditorLinter::OnCheckDone(ax::event::Msg* msg)
+{
+	Diagnostic result;
+	int generation;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		result = _result;
+		generation = _result_generation;
+	}
+
+	if (generation != _generation || generation == _checked_generation) {
+		return;
+	}
+
+	const bool changed = result.valid != _diagnostic.valid || result.line != _diagnostic.line
+		|| result.msg != _diagnostic.msg;
+
+	_diagnostic = result;
+	_checked_generation = generation;
+
+	if (changed) {
+		PushEvent(DIAGNOSTIC_CHANGE, new ax::event::EmptyMsg());
+	}
+}
+
+void TextEditorLinter::CheckThread()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (true) {
+		_cond.wait(lock, [this]() {
+			return !_running || _text != nullptr || _generation != _requested_generation;
+		});
+
+		if (!_running) {
+			return;
+		}
+
+		if (_text != nullptr) {
+			std::shared_ptr<const std::string> text = std::move(_text);
+			const int generation = _text_generation;
+			_text = nullptr;
+			lock.unlock();
+
+			Diagnostic result;
+			result.valid = pyo_compile_check(_interp, *text, result.line, result.msg);
+			result.line = result.valid ? -1 : result.line - 1;
+
+			lock.lock();
+			_result = result;
+			_result_generation = generation;
+			PushEvent(CHECK_DONE, new ax::event::EmptyMsg());
+			continue;
+		}
+
+		// Wait for typing to pause.
+		const std::chrono::steady_clock::time_point deadline
+			= _last_modification + std::chrono::milliseconds(CHECK_DELAY_MS);
+
+		if (std::chrono::steady_clock::now() < deadline) {
+			_cond.wait_until(lock, deadline);
+			continue;
+		}
+
+		_requested_generation = _generation;
+		PushEvent(CHECK_REQUEST, new ax::event::SimpleMsg<int>(_requested_generation));
+	}
+}
@@ -34,6 +34,7 @@ TextEditorLogic::TextEditorLogic()
 	, _cursor_pos(-1, -1)
 	, _selection_rectangle{ false, ax::Point(-1, -1), ax::Point(-1, -1) }
 {
+	_file_data.AddListener(&_search);
 }
 
 bool TextEditorLogic::OpenFile(const std::string& file_path)
@@ -47,7 +48,8 @@ bool TextEditorLogic::OpenFile(const std::string& file_path)
 	// Remove all tab for string.
 	ax::util::String::ReplaceCharWithString(file_str, '\t', "    ");
 
-	_file_data = ax::util::String::Split(file_str, "\n");
+	_file_data.SetLines(ax::util::String::Split(file_str, "\n"));
+	_journal.Clear();
 
 	_cursor_pos = ax::Point(0, 0);
 
@@ -59,22 +61,15 @@ bool TextEditorLogic::SaveFile(const std::string& file_path)
 	_file_path = file_path;
 
 	std::ofstream out(file_path);
-
-	for (auto& n : _file_data) {
-		out << n << std::endl;
-	}
-
+	out << *_file_data.GetText();
 	out.close();
 
-	return true;
-}
+	_journal.SetCheckpoint();
 
-std::vector<std::string>& TextEditorLogic::GetFileData()
-{
-	return _file_data;
+	return true;
 }
 
-const std::vector<std::string>& TextEditorLogic::GetFileData() const
+const TextBuffer& TextEditorLogic::GetFileData() const
 {
 	return _file_data;
 }
@@ -91,18 +86,22 @@ ax::Point TextEditorLogic::GetCursorPosition() const
 
 void TextEditorLogic::SetCursorPosition(const ax::Point& cursor_pos)
 {
-	if (cursor_pos.y < _file_data.size()) {
-		if (cursor_pos.x < _file_data[cursor_pos.y].size()) {
+	_journal.BreakMerging();
+
+	if (cursor_pos.y >= 0 && cursor_pos.y < (int)_file_data.GetLineCount()) {
+		if (cursor_pos.x < _file_data.GetLineLength(cursor_pos.y)) {
 			_cursor_pos = cursor_pos;
 		}
 		else {
-			_cursor_pos = ax::Point((int)_file_data[cursor_pos.y].size(), cursor_pos.y);
+			_cursor_pos = ax::Point(_file_data.GetLineLength(cursor_pos.y), cursor_pos.y);
 		}
 	}
 }
 
 void TextEditorLogic::MoveCursorRight()
 {
+	_journal.BreakMerging();
+
 	if (_selection_rectangle.active) {
 		_cursor_pos = _selection_rectangle.right;
 		_selection_rectangle.active = false;
@@ -113,8 +112,8 @@ void TextEditorLogic::MoveCursorRight()
 
 	// Block cursor position at the last char index + 1
 	// to allow append at the end of line.
-	if (x_pos > _file_data[_cursor_pos.y].size()) {
-		x_pos = (int)_file_data[_cursor_pos.y].size();
+	if (x_pos > _file_data.GetLineLength(_cursor_pos.y)) {
+		x_pos = _file_data.GetLineLength(_cursor_pos.y);
 	}
 
 	_cursor_pos.x = x_pos;
@@ -122,6 +121,8 @@ void TextEditorLogic::MoveCursorRight()
 
 void TextEditorLogic::MoveCursorLeft()
 {
+	_journal.BreakMerging();
+
 	if (_selection_rectangle.active) {
 		_cursor_pos = _selection_rectangle.left;
 		_selection_rectangle.active = false;
@@ -139,6 +140,8 @@ void TextEditorLogic::MoveCursorLeft()
 
 void TextEditorLogic::MoveCursorUp()
 {
+	_journal.BreakMerging();
+
 	if (_selection_rectangle.active) {
 		_cursor_pos = _selection_rectangle.left;
 		_selection_rectangle.active = false;
@@ -153,8 +156,8 @@ void TextEditorLogic::MoveCursorUp()
 	}
 
 	// Block x cursor position at last char of line + 1.
-	if (x_pos > _file_data[y_pos].size()) {
-		x_pos = (int)_file_data[y_pos].size();
+	if (x_pos > _file_data.GetLineLength(y_pos)) {
+		x_pos = _file_data.GetLineLength(y_pos);
 	}
 
 	_cursor_pos.x = x_pos;
@@ -163,6 +166,8 @@ void TextEditorLogic::MoveCursorUp()
 
 void TextEditorLogic::MoveCursorDown()
 {
+	_journal.BreakMerging();
+
 	if (_selection_rectangle.active) {
 		_cursor_pos = _selection_rectangle.right;
 		_selection_rectangle.active = false;
@@ -172,13 +177,13 @@ void TextEditorLogic::MoveCursorDown()
 	int y_pos = _cursor_pos.y + 1;
 
 	// Block cursor at last line.
-	if (y_pos > (int)_file_data.size() - 1) {
-		y_pos = (int)_file_data.size() - 1;
+	if (y_pos > (int)_file_data.GetLineCount() - 1) {
+		y_pos = (int)_file_data.GetLineCount() - 1;
 
 		// ax::console::Print("Logic :: Cursor last line");
 
 		// Set cursor at the last char of last line.
-		x_pos = (int)_file_data[y_pos].size();
+		x_pos = _file_data.GetLineLength(y_pos);
 
 		_cursor_pos.x = x_pos;
 		_cursor_pos.y = y_pos;
@@ -186,8 +191,8 @@ void TextEditorLogic::MoveCursorDown()
 	}
 
 	// Block x cursor position at last char of line + 1.
-	if (x_pos > _file_data[y_pos].size()) {
-		x_pos = (int)_file_data[y_pos].size();
+	if (x_pos > _file_data.GetLineLength(y_pos)) {
+		x_pos = _file_data.GetLineLength(y_pos);
 	}
 
 	_cursor_pos.x = x_pos;
@@ -196,7 +201,10 @@ void TextEditorLogic::MoveCursorDown()
 
 void TextEditorLogic::AddChar(const char& c)
 {
-	if (_selection_rectangle.active) {
+	// Replacing selected text is a single undo step.
+	const bool replace = _selection_rectangle.active;
+
+	if (replace) {
 		RemoveSelectedText();
 	}
 
@@ -205,127 +213,264 @@ void TextEditorLogic::AddChar(const char& c)
 	//	ax::console::Print("AddChar :", (int)c);
 
 	// Insert char.
-	if (c == TAB) {
-		_file_data[_cursor_pos.y].insert(_cursor_pos.x, std::string("    "));
-		_cursor_pos.x += 4;
-		return;
-	}
+	InsertAt(_cursor_pos, c == TAB ? std::string("    ") : std::string(1, c), replace);
+}
 
-	// Append at the end of the line.
-	if (_cursor_pos.x == _file_data[_cursor_pos.y].size()) {
+void TextEditorLogic::InsertText(const std::string& text)
+{
+	const bool replace = _selection_rectangle.active;
 
-		_file_data[_cursor_pos.y].push_back(c);
-		_cursor_pos.x++;
-		return;
+	if (replace) {
+		RemoveSelectedText();
 	}
 
-	_file_data[_cursor_pos.y].insert(_cursor_pos.x, 1, c);
-	_cursor_pos.x++;
+	if (!text.empty()) {
+		InsertAt(_cursor_pos, text, replace);
+	}
 }
 
 void TextEditorLogic::Enter()
 {
-	if (_selection_rectangle.active) {
+	const bool replace = _selection_rectangle.active;
+
+	if (replace) {
 		RemoveSelectedText();
 	}
 
-	// Append at the end of the line.
-	if (_cursor_pos.x == _file_data[_cursor_pos.y].size()) {
-		_file_data.insert(_file_data.begin() + _cursor_pos.y + 1, std::string(""));
+	// Right part of the line goes on a new line.
+	InsertAt(_cursor_pos, "\n", replace);
+}
 
-		_cursor_pos.x = 0;
-		_cursor_pos.y++;
+void TextEditorLogic::Delete()
+{
+	if (_selection_rectangle.active) {
+		RemoveSelectedText();
 		return;
 	}
 
-	// Beginning of not empty line.
-	if (_cursor_pos.x == 0) {
-		_file_data.insert(_file_data.begin() + _cursor_pos.y, std::string(""));
-
-		_cursor_pos.y++;
+	// Nothing to do when delete on last char of last line.
+	if (_cursor_pos.x == _file_data.GetLineLength(_cursor_pos.y)
+		&& _cursor_pos.y == (int)_file_data.GetLineCount() - 1) {
 		return;
 	}
 
-	// Enter in middle of line.
-	std::string old_str = _file_data[_cursor_pos.y].substr(0, _cursor_pos.x);
-	std::string new_str = _file_data[_cursor_pos.y].substr(_cursor_pos.x);
+	// Delete at the end of line joins next line.
+	const ax::Point right = _cursor_pos.x == _file_data.GetLineLength(_cursor_pos.y)
+		? ax::Point(0, _cursor_pos.y + 1)
+		: ax::Point(_cursor_pos.x + 1, _cursor_pos.y);
 
-	_file_data[_cursor_pos.y] = old_str;
-	_file_data.insert(_file_data.begin() + _cursor_pos.y + 1, new_str);
-
-	_cursor_pos.x = 0;
-	_cursor_pos.y++;
+	EraseRange(_cursor_pos, right);
 }
 
-void TextEditorLogic::Delete()
+void TextEditorLogic::BackSpace()
 {
 	if (_selection_rectangle.active) {
 		RemoveSelectedText();
 		return;
 	}
 
-	// Nothing to do when delete on last char of last line.
-	if (_cursor_pos.x == _file_data[_cursor_pos.y].size() && _cursor_pos.y == _file_data.size() - 1) {
+	// Nothing to do when backspace at the begenning of first line.
+	if (_cursor_pos.x == 0 && _cursor_pos.y == 0) {
 		return;
 	}
 
-	// Delete at the end of line.
-	if (_cursor_pos.x == _file_data[_cursor_pos.y].size()) {
-		std::string next_line = _file_data[_cursor_pos.y + 1];
-		_file_data[_cursor_pos.y] += next_line;
+	// Backspace at the beginning of line appends line to the line above.
+	const ax::Point left = _cursor_pos.x == 0
+		? ax::Point(_file_data.GetLineLength(_cursor_pos.y - 1), _cursor_pos.y - 1)
+		: ax::Point(_cursor_pos.x - 1, _cursor_pos.y);
 
-		// Delete old line.
-		_file_data.erase(_file_data.begin() + _cursor_pos.y + 1);
-		return;
+	EraseRange(left, _cursor_pos);
+}
+
+bool TextEditorLogic::Undo()
+{
+	const TextEditorJournal::Entry* entry = _journal.Undo();
+
+	if (entry == nullptr) {
+		return false;
 	}
 
-	// Remove char in middle of line.
-	_file_data[_cursor_pos.y].erase(_file_data[_cursor_pos.y].begin() + _cursor_pos.x);
+	_selection_rectangle.active = false;
+
+	for (auto it = entry->rbegin(); it != entry->rend(); ++it) {
+		if (it->type == TextEditorJournal::Edit::INSERT) {
+			RemoveText(it->pos, TextEditorJournal::GetEndPosition(it->pos, it->text));
+		}
+		else {
+			AddText(it->pos, it->text);
+		}
+	}
+
+	_cursor_pos = entry->front().cursor_before;
+	return true;
 }
 
-void TextEditorLogic::BackSpace()
+bool TextEditorLogic::Redo()
 {
-	if (_selection_rectangle.active) {
-		RemoveSelectedText();
-		return;
+	const TextEditorJournal::Entry* entry = _journal.Redo();
+
+	if (entry == nullptr) {
+		return false;
 	}
 
-	// Nothing to do when backspace at the begenning of first line.
-	if (_cursor_pos.x == 0 && _cursor_pos.y == 0) {
-		return;
+	_selection_rectangle.active = false;
+
+	for (auto& n : *entry) {
+		if (n.type == TextEditorJournal::Edit::INSERT) {
+			AddText(n.pos, n.text);
+		}
+		else {
+			RemoveText(n.pos, TextEditorJournal::GetEndPosition(n.pos, n.text));
+		}
 	}
 
-	// Backspace at the beginning of line.
-	if (_cursor_pos.x == 0) {
-		std::string line = _file_data[_cursor_pos.y];
-		int end_line_pos = (int)_file_data[_cursor_pos.y - 1].size();
+	_cursor_pos = entry->back().cursor_after;
+	return true;
+}
+
+bool TextEditorLogic::FindNext()
+{
+	const ax::Point from = _selection_rectangle.active ? _selection_rectangle.right : _cursor_pos;
+	ax::Point left, right;
 
-		// Append line to the line above.
-		_file_data[_cursor_pos.y - 1] += line;
+	if (!_search.FindNext(_file_data, from, left, right)) {
+		return false;
+	}
 
-		// Delete old line.
-		_file_data.erase(_file_data.begin() + _cursor_pos.y);
+	_journal.BreakMerging();
+	_selection_rectangle = SelectionRectangle{ true, left, right };
+	_cursor_pos = right;
+	return true;
+}
 
-		_cursor_pos.x = end_line_pos;
-		_cursor_pos.y--;
-		return;
+bool TextEditorLogic::ReplaceNext(const std::string& replacement)
+{
+	const ax::Point& left = _selection_rectangle.left;
+	const ax::Point& right = _selection_rectangle.right;
+	TextEditorSearch::Match match{ 0, 0 };
+	bool is_match = false;
+
+	// Only replace selection if it is a match.
+	if (_selection_rectangle.active && left.y == right.y) {
+		for (auto& n : _search.GetLineMatches(_file_data, left.y)) {
+			if (n.begin == left.x && n.end == right.x) {
+				match = n;
+				is_match = true;
+				break;
+			}
+		}
+	}
+
+	if (is_match) {
+		const ax::Point pos = left;
+		const std::string text = _search.GetReplacement(_file_data.GetLine(pos.y), match, replacement);
+		_selection_rectangle.active = false;
+
+		_journal.BreakMerging();
+		EraseRange(pos, right);
+		InsertAt(pos, text, true);
 	}
 
-	// Remove at the end of the line.
-	if (_cursor_pos.x == _file_data[_cursor_pos.y].size()) {
-		//        ax::console::Print("POP");
-		_file_data[_cursor_pos.y].pop_back();
-		_cursor_pos.x--;
+	const bool found = FindNext() || is_match;
+
+	// Typing after a replace starts a new undo entry.
+	_journal.BreakMerging();
+	return found;
+}
+
+int TextEditorLogic::ReplaceAll(const std::string& replacement)
+{
+	if (!_search.IsActive()) {
+		return 0;
+	}
 
-		if (_cursor_pos.x < 0) {
-			_cursor_pos.x = 0;
+	struct Replacement {
+		ax::Point left;
+		ax::Point right;
+		std::string text;
+	};
+
+	// Replacement texts are made before any edit so every match sees its original line.
+	std::vector<Replacement> replacements;
+
+	for (std::size_t i = 0; i < _file_data.GetLineCount(); i++) {
+		for (auto& n : _search.GetLineMatches(_file_data, i)) {
+			replacements.push_back(Replacement{ ax::Point(n.begin, (int)i), ax::Point(n.end, (int)i),
+				_search.GetReplacement(_file_data.GetLine(i), n, replacement) });
 		}
+	}
+
+	_selection_rectangle.active = false;
+	_journal.BreakMerging();
+
+	// From last to first so positions of remaining matches don't move.
+	for (int i = (int)replacements.size() - 1; i >= 0; i--) {
+		const Replacement& r = replacements[i];
+		EraseRange(r.left, r.right, i != (int)replacements.size() - 1);
+		InsertAt(r.left, r.text, true);
+	}
+
+	_journal.BreakMerging();
+	return (int)replacements.size();
+}
+
+void TextEditorLogic::InsertAt(const ax::Point& pos, const std::string& text, bool merge)
+{
+	const ax::Point end = TextEditorJournal::GetEndPosition(pos, text);
+	_journal.Record(
+		TextEditorJournal::Edit{ TextEditorJournal::Edit::INSERT, pos, text, _cursor_pos, end }, merge);
+
+	AddText(pos, text);
+	_cursor_pos = end;
+}
+
+void TextEditorLogic::EraseRange(const ax::Point& left, const ax::Point& right, bool merge)
+{
+	const std::string text = GetContent(left, right);
+	_journal.Record(
+		TextEditorJournal::Edit{ TextEditorJournal::Edit::ERASE, left, text, _cursor_pos, left }, merge);
+
+	RemoveText(left, right);
+	_cursor_pos = left;
+}
+
+void TextEditorLogic::AddText(const ax::Point& pos, const std::string& text)
+{
+	std::size_t new_line = text.find('\n');
+
+	if (new_line == std::string::npos) {
+		_file_data.Insert(pos.y, pos.x, text);
+		return;
+	}
+
+	// Split line at pos, first and last lines of text are merged with both parts.
+	std::vector<std::string> lines;
+	std::size_t begin = new_line + 1;
+
+	while ((new_line = text.find('\n', begin)) != std::string::npos) {
+		lines.push_back(text.substr(begin, new_line - begin));
+		begin = new_line + 1;
+	}
+
+	_file_data.SplitLine(pos.y, pos.x);
+	_file_data.Append(pos.y, text.substr(0, text.find('\n')));
+	_file_data.Insert(pos.y + 1, 0, text.substr(begin));
+	_file_data.InsertLines(pos.y + 1, lines);
+}
+
+void TextEditorLogic::RemoveText(const ax::Point& left, const ax::Point& right)
+{
+	// One line.
+	if (left.y == right.y) {
+		_file_data.Erase(left.y, left.x, right.x - left.x);
 		return;
 	}
 
-	// Remove char in middle of line.
-	_file_data[_cursor_pos.y].erase(_file_data[_cursor_pos.y].begin() + _cursor_pos.x - 1);
-	_cursor_pos.x--;
+	// Crop first line, remove middle lines and append the rest of the last line to first line.
+	_file_data.Erase(left.y, left.x, _file_data.GetLineLength(left.y) - left.x);
+	_file_data.Erase(right.y, 0, right.x);
+	_file_data.EraseLines(left.y + 1, right.y);
+	_file_data.JoinLine(left.y);
 }
 
 void TextEditorLogic::UnselectRectangle()
@@ -337,19 +482,19 @@ void TextEditorLogic::SelectCurrentLine()
 {
 	_selection_rectangle.active = true;
 	_selection_rectangle.left = ax::Point(0, _cursor_pos.y);
-	_selection_rectangle.right = ax::Point(_file_data[_cursor_pos.y].size(), _cursor_pos.y);
+	_selection_rectangle.right = ax::Point(_file_data.GetLineLength(_cursor_pos.y), _cursor_pos.y);
 }
 
 void TextEditorLogic::SelectCurrentWord()
 {
-	const int line_length((int)_file_data[_cursor_pos.y].size());
+	const int line_length(_file_data.GetLineLength(_cursor_pos.y));
 
 	if (_cursor_pos.x >= line_length) {
 		_selection_rectangle.active = false;
 		return;
 	}
 
-	char cur_char = _file_data[_cursor_pos.y][_cursor_pos.x];
+	char cur_char = _file_data.GetLine(_cursor_pos.y)[_cursor_pos.x];
 
 	// Clicking on special character.
 	if (fst::ascii::is_special(cur_char) || fst::ascii::is_space_or_tab(cur_char)) {
@@ -373,7 +518,7 @@ void TextEditorLogic::SelectCurrentWord()
 	_selection_rectangle.left.y = _cursor_pos.y;
 
 	for (int i = _cursor_pos.x; i > 0; i--) {
-		char l_char = _file_data[_cursor_pos.y][i];
+		char l_char = _file_data.GetLine(_cursor_pos.y)[i];
 		if (fst::ascii::is_special(l_char) || fst::ascii::is_space_or_tab(l_char)) {
 			_selection_rectangle.left.x = i;
 			break;
@@ -385,11 +530,11 @@ void TextEditorLogic::SelectCurrentWord()
 	}
 
 	// Find word right position.
-	_selection_rectangle.right.x = _file_data[_cursor_pos.y].size();
+	_selection_rectangle.right.x = _file_data.GetLineLength(_cursor_pos.y);
 	_selection_rectangle.right.y = _cursor_pos.y;
 
-	for (int i = _cursor_pos.x; i < _file_data[_cursor_pos.y].size(); i++) {
-		char r_char = _file_data[_cursor_pos.y][i];
+	for (int i = _cursor_pos.x; i < _file_data.GetLineLength(_cursor_pos.y); i++) {
+		char r_char = _file_data.GetLine(_cursor_pos.y)[i];
 		if (fst::ascii::is_special(r_char) || fst::ascii::is_space_or_tab(r_char)) {
 			_selection_rectangle.right.x = i;
 			break;
@@ -429,95 +574,9 @@ void TextEditorLogic::RemoveSelectedText()
 	// Deselect text.
 	_selection_rectangle.active = false;
 
-	// Set cursor position to left side of selected rectangle.
-	_cursor_pos = _selection_rectangle.left;
-
-	// One line selection.
-	if (_selection_rectangle.left.y == _selection_rectangle.right.y) {
-		std::string& line = _file_data[_selection_rectangle.left.y];
-		line.erase(line.begin() + _selection_rectangle.left.x, line.begin() + _selection_rectangle.right.x);
-		return;
-	}
-
-	// Two lines selection.
-	if (_selection_rectangle.right.y - _selection_rectangle.left.y == 1) {
-		// Delete first line completely.
-		if (_selection_rectangle.left.x == 0) {
-			// Remove line.
-			_file_data.erase(_file_data.begin() + _selection_rectangle.left.y);
-			_selection_rectangle.left = ax::Point(0, _selection_rectangle.left.y);
-
-			// Remove second line.
-			std::string& line = _file_data[_selection_rectangle.left.y];
-			line.erase(
-				line.begin() + _selection_rectangle.left.x, line.begin() + _selection_rectangle.right.x);
-			return;
-		}
-
-		// Delete second line completely.
-		if (_selection_rectangle.right.x == _file_data[_selection_rectangle.right.y].size()) {
-			// Remove last line.
-			_file_data.erase(_file_data.begin() + _selection_rectangle.right.y);
-
-			// Set selection right side to last character of first line.
-			_selection_rectangle.right
-				= ax::Point(GetLineLength(_selection_rectangle.left.y), _selection_rectangle.left.y);
-
-			// Crop first line.
-			std::string& line = _file_data[_selection_rectangle.left.y];
-			line.erase(
-				line.begin() + _selection_rectangle.left.x, line.begin() + _selection_rectangle.right.x);
-
-			return;
-		}
-
-		// Copy last selected line.
-		std::string cropped_last_line = _file_data[_selection_rectangle.right.y];
-
-		// Delete left side of second line and keep the right part.
-		cropped_last_line.erase(
-			cropped_last_line.begin(), cropped_last_line.begin() + _selection_rectangle.right.x);
-
-		// Remove last line.
-		_file_data.erase(_file_data.begin() + _selection_rectangle.right.y);
-
-		// Set selection right side to last character of first line.
-		_selection_rectangle.right
-			= ax::Point(_file_data[_selection_rectangle.left.y].size(), _selection_rectangle.left.y);
-
-		// Crop first line.
-		std::string& first_line = _file_data[_selection_rectangle.left.y];
-		first_line.erase(first_line.begin() + _selection_rectangle.left.x,
-			first_line.begin() + _selection_rectangle.right.x);
-
-		// Append the rest of the last line to first line.
-		first_line.append(cropped_last_line);
-		return;
-	}
-
-	// Multiple lines selection.
-	// Copy last selected line.
-	std::string cropped_last_line = _file_data[_selection_rectangle.right.y];
-
-	// Delete left side of second line and keep the right part.
-	cropped_last_line.erase(
-		cropped_last_line.begin(), cropped_last_line.begin() + _selection_rectangle.right.x);
-
-	// Remove middle lines.
-	_file_data.erase(_file_data.begin() + _selection_rectangle.left.y + 1,
-		_file_data.begin() + _selection_rectangle.right.y);
-
-	// Set selection right side to last character of first line.
-	_selection_rectangle.right
-		= ax::Point(_file_data[_selection_rectangle.left.y].size(), _selection_rectangle.left.y);
-
-	// Crop first line.
-	std::string& first_line = _file_data[_selection_rectangle.left.y];
-	first_line.erase(
-		first_line.begin() + _selection_rectangle.left.x, first_line.begin() + _selection_rectangle.right.x);
-
-	// Append the rest of the last line to first line.
-	first_line.append(cropped_last_line);
+	// Cursor ends on left side of selected rectangle.
+	_journal.BreakMerging();
+	EraseRange(_selection_rectangle.left, _selection_rectangle.right);
 }
 
 void TextEditorLogic::AssignSelectionPos(const ax::Point& pos)
@@ -542,7 +601,8 @@ void TextEditorLogic::SelectAll()
 {
 	_selection_rectangle.active = true;
 	_selection_rectangle.left = ax::Point(0, 0);
-	_selection_rectangle.right = ax::Point(_file_data[_file_data.size() - 1].size(), _file_data.size());
+	const int last_line = (int)_file_data.GetLineCount() - 1;
+	_selection_rectangle.right = ax::Point(_file_data.GetLineLength(last_line), last_line);
 }
 
 std::string TextEditorLogic::GetSelectedContent() const
@@ -551,25 +611,22 @@ std::string TextEditorLogic::GetSelectedContent() const
 		return "";
 	}
 
-	const ax::Point& left = _selection_rectangle.left;
-	const ax::Point& right = _selection_rectangle.right;
+	return GetContent(_selection_rectangle.left, _selection_rectangle.right);
+}
 
+std::string TextEditorLogic::GetContent(const ax::Point& left, const ax::Point& right) const
+{
 	// One line.
 	if (left.y == right.y) {
-		return _file_data[left.y].substr(left.x, right.x);
+		return _file_data.GetLine(left.y).substr(left.x, right.x - left.x);
 	}
 
 	// Multiple lines.
-	std::string content = _file_data[left.y].substr(left.x) + "\n";
-
-	// Two lines.
-	if (right.y - left.y == 1) {
-		return content + _file_data[right.y].substr(0, right.x);
-	}
+	std::string content = _file_data.GetLine(left.y).substr(left.x) + "\n";
 
 	for (int i = left.y + 1; i < right.y; i++) {
-		content += _file_data[i] + "\n";
+		content += _file_data.GetLine(i) + "\n";
 	}
 
-	return content + _file_data[right.y].substr(0, right.x);
+	return content + _file_data.GetLine(right.y).substr(0, right.x);
 }
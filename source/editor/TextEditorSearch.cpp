@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/TextEditorSearch.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+TextEditorSearch::TextEditorSearch()
+	: _regex(false)
+	, _match_case(true)
+{
+}
+
+bool TextEditorSearch::SetPattern(const std::string& pattern, bool regex, bool match_case)
+{
+	Clear();
+
+	if (pattern.empty()) {
+		return true;
+	}
+
+	if (regex) {
+		try {
+			_re = std::regex(pattern, match_case ? std::regex::ECMAScript
+												 : std::regex::ECMAScript | std::regex::icase);
+		}
+		catch (std::regex_error& err) {
+			ax::console::Error("Search regex :", err.what());
+			return false;
+		}
+	}
+
+	_pattern = pattern;
+	_regex = regex;
+	_match_case = match_case;
+	_search_pattern = pattern;
+
+	if (!match_case) {
+		std::transform(_search_pattern.begin(), _search_pattern.end(), _search_pattern.begin(), ::tolower);
+	}
+
+	// Horspool bad character table.
+	const std::size_t size = _search_pattern.size();
+	std::fill(_skip, _skip + 256, size);
+
+	for (std::size_t i = 0; i + 1 < size; i++) {
+		_skip[(unsigned char)_search_pattern[i]] = size - 1 - i;
+	}
+
+	return true;
+}
+
+void TextEditorSearch::Clear()
+{
+	_pattern.clear();
+	_search_pattern.clear();
+	_lines.clear();
+}
+
+const std::vector<TextEditorSearch::Match>& TextEditorSearch::GetLineMatches(
+	const TextBuffer& buffer, std::size_t line)
+{
+	if (_lines.size() != buffer.GetLineCount()) {
+		_lines.assign(buffer.GetLineCount(), Line{ false, std::vector<Match>() });
+	}
+
+	Line& l = _lines[line];
+
+	if (!l.valid) {
+		l.matches.clear();
+
+		if (IsActive()) {
+			SearchLine(buffer.GetLine(line), l.matches);
+		}
+
+		l.valid = true;
+	}
+
+	return l.matches;
+}
+
+bool TextEditorSearch::FindNext(
+	const TextBuffer& buffer, const ax::Point& pos, ax::Point& left, ax::Point& right)
+{
+	if (!IsActive()) {
+		return false;
+	}
+
+	const std::size_t n_lines = buffer.GetLineCount();
+
+	// Last iteration goes back to the beginning of the first line.
+	for (std::size_t i = 0; i <= n_lines; i++) {
+		const std::size_t line = (pos.y + i) % n_lines;
+		const std::vector<Match>& matches = GetLineMatches(buffer, line);
+
+		for (auto& n : matches) {
+			if (i == 0 && n.begin < pos.x) {
+				continue;
+			}
+
+			if (i == n_lines && n.begin >= pos.x) {
+				return false;
+			}
+
+			left = ax::Point(n.begin, (int)line);
+			right = ax::Point(n.end, (int)line);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::size_t TextEditorSearch::FindAll(const TextBuffer& buffer)
+{
+	std::size_t count = 0;
+
+	for (std::size_t i = 0; i < buffer.GetLineCount(); i++) {
+		count += GetLineMatches(buffer, i).size();
+	}
+
+	return count;
+}
+
+std::string TextEditorSearch::GetReplacement(
+	const std::string& line, const Match& match, const std::string& replacement) const
+{
+	if (!_regex) {
+		return replacement;
+	}
+
+	// Match again at the same position in the whole line, lookahead and \b need the text around it.
+	std::regex_constants::match_flag_type flags = std::regex_constants::match_continuous;
+
+	if (match.begin > 0) {
+		flags |= std::regex_constants::match_prev_avail;
+	}
+
+	std::smatch result;
+
+	if (!std::regex_search(line.begin() + match.begin, line.end(), result, _re, flags)) {
+		return replacement;
+	}
+
+	return result.format(replacement);
+}
+
+void TextEditorSearch::SearchLine(const std::string& text, std::vector<Match>& matches) const
+{
+	if (_regex) {
+		for (std::sregex_iterator it(text.begin(), text.end(), _re), end; it != end; ++it) {
+			// Skip empty matches.
+			if (it->length() > 0) {
+				matches.push_back(Match{ (int)it->position(), int(it->position() + it->length()) });
+			}
+		}
+
+		return;
+	}
+
+	std::size_t from = 0;
+	int pos;
+
+	while ((pos = FindLiteral(text, from)) != -1) {
+		matches.push_back(Match{ pos, pos + (int)_search_pattern.size() });
+		from = pos + _search_pattern.size();
+	}
+}
+
+int TextEditorSearch::FindLiteral(const std::string& text, std::size_t from) const
+{
+	const std::size_t size = _search_pattern.size();
+
+	if (from + size > text.size()) {
+		return -1;
+	}
+
+	// Single char uses memchr.
+	if (size == 1 && _match_case) {
+		const void* p = std::memchr(text.data() + from, _search_pattern[0], text.size() - from);
+		return p == nullptr ? -1 : int((const char*)p - text.data());
+	}
+
+	for (std::size_t i = from; i + size <= text.size();) {
+		std::size_t j = size;
+
+		while (j > 0) {
+			const char c = _match_case ? text[i + j - 1] : (char)std::tolower((unsigned char)text[i + j - 1]);
+
+			if (c != _search_pattern[j - 1]) {
+				break;
+			}
+
+			j--;
+		}
+
+		if (j == 0) {
+			return (int)i;
+		}
+
+		const unsigned char last = (unsigned char)text[i + size - 1];
+		i += _skip[_match_case ? last : (unsigned char)std::tolower(last)];
+	}
+
+	return -1;
+}
+
+void TextEditorSearch::OnLineChanged(std::size_t line)
+{
+	if (line < _lines.size()) {
+		_lines[line].valid = false;
+	}
+}
+
+void TextEditorSearch::OnLinesInserted(std::size_t index, std::size_t count)
+{
+	if (!_lines.empty()) {
+		index = std::min(index, _lines.size());
+		_lines.insert(_lines.begin() + index, count, Line{ false, std::vector<Match>() });
+	}
+}
+
+void TextEditorSearch::OnLinesErased(std::size_t first, std::size_t last)
+{
+	last = std::min(last, _lines.size());
+
+	if (first < last) {
+		_lines.erase(_lines.begin() + first, _lines.begin() + last);
+	}
+}
@@ -27,6 +27,9 @@
 #include "atCommon.hpp"
 #include "editor/atEditor.hpp"
 #include "editor/atEditorMainWindow.hpp"
+#include "editor/atEditorPyDoc.hpp"
+#include "editor/atEditorWidgetDescriptorCache.hpp"
+#include "editor/atEditorWidgetMenu.hpp"
 
 #include <pwd.h>
 #include <sys/types.h>
@@ -35,7 +38,9 @@
 #include "PyoAudio.h"
 #include "atMidi.h"
 
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
+#include "atTaskGraph.hpp"
 #include "dialog/atSplashDialog.hpp"
 
 namespace at {
@@ -98,31 +103,73 @@ namespace editor {
 			// app.GetEventManager()->AddFunction(ax::event::axBindedEvent(_on_splash_open, new
 			// ax::event::EmptyMsg()));
 
+			// Cache is created on the ui thread, the loading thread only queues preloading.
+			ResourceCache::GetInstance();
+
 			// Start loading thread (audio and data).
-			_loading_thread = std::thread(
-				[](ax::event::Object& obj) {
-					using MsgType = ax::event::SimpleMsg<at::SplashDialog::LoadInfoMsg>;
-					obj.PushEvent(Events::LOADING_EVT_ID,
-						new MsgType(at::SplashDialog::LoadInfoMsg(0.2, "Loading audio ...")));
+			_loading_thread = std::thread(&App::RunStartupTasks, std::ref(_obj));
+			_loading_thread.detach();
+		});
+	}
 
-					PyoAudio* audio = PyoAudio::GetInstance();
-					audio->InitAudio();
-					audio->StartAudio();
+	void App::RunStartupTasks(ax::event::Object& obj)
+	{
+		using MsgType = ax::event::SimpleMsg<at::SplashDialog::LoadInfoMsg>;
+		std::vector<std::string> images = { "resources/tree_icon.png", "resources/tree_icon_panel.png" };
+		TaskGraph graph;
+
+		// PortAudio device scan doesn't need the pyo server.
+		const TaskGraph::Id audio_host = graph.Add("Audio host", []() { atk::AudioCore::InitHost(); });
+		const TaskGraph::Id python = graph.Add("Python", []() { PyoAudio::GetInstance(); });
+
+		graph.Add("Audio",
+			[]() {
+				PyoAudio* audio = PyoAudio::GetInstance();
+				audio->InitAudio();
+				audio->StartAudio();
+			},
+			{ audio_host, python });
+
+		// Midi callbacks are sent to the pyo server.
+		/// @todo Save this somewhere.
+		graph.Add("Midi", []() { at::Midi::GetInstance(); }, { python });
+
+		graph.Add("Documentation", []() { PyDoc::LoadClassBriefs(); }, { python });
+
+		const TaskGraph::Id widgets = graph.Add("Widgets", [&images]() {
+			for (auto& n : WidgetMenu::GetWidgetsInfo()) {
+				images.push_back(n.widget_img);
+			}
+
+			WidgetDescriptorCache::GetInstance()->Save();
+		});
 
-					obj.PushEvent(Events::LOADING_EVT_ID,
-						new MsgType(at::SplashDialog::LoadInfoMsg(0.7, "Load midi ...")));
+		ResourceCache* cache = ResourceCache::GetInstance();
 
-					/// @todo Save this somewhere.
-					// at::Midi* midi = at::Midi::GetInstance();
-					at::Midi::GetInstance();
+		graph.Add("Images",
+			[&images, cache]() {
+				cache->Preload(images);
+				cache->WaitForPreload();
+			},
+			{ widgets });
 
-					obj.PushEvent(
-						Events::LOADING_EVT_ID, new MsgType(at::SplashDialog::LoadInfoMsg(1.0, "Done")));
+		const double n_tasks = (double)graph.GetTasks().size();
 
-				},
-				std::ref(_obj));
-			_loading_thread.detach();
+		// Done (1.0) is only sent once everything is loaded.
+		graph.Run(3, [&obj, n_tasks](const TaskGraph::Task& task, bool done, std::size_t n_done) {
+			const std::string info(done ? task.name + " loaded." : "Loading " + task.name + " ...");
+			const double percent = 0.9 * n_done / n_tasks;
+			obj.PushEvent(Events::LOADING_EVT_ID, new MsgType(at::SplashDialog::LoadInfoMsg(percent, info)));
 		});
+
+		for (auto& n : graph.GetTasks()) {
+			ax::console::Print(
+				"Startup :", n.name, "started at", n.start_ms, "ms, took", n.duration_ms, "ms.");
+		}
+
+		ax::console::Print("Startup : total", graph.GetTotalTime(), "ms.");
+
+		obj.PushEvent(Events::LOADING_EVT_ID, new MsgType(at::SplashDialog::LoadInfoMsg(1.0, "Done")));
 	}
 
 	MainWindow* App::GetMainWindow()
@@ -106,6 +106,136 @@ namespace editor {
 
 		AttachHelpInfo(console_clean_btn->GetWindow(), "Erase console content.");
 		_console_clean_btn->GetWindow()->Hide();
+
+		// Find bar.
+		_find_bar = ax::Window::Create(ax::Rect(rect.size.w - FIND_BAR_WIDTH, 3, FIND_BAR_WIDTH, 19));
+		win->node.Add(std::shared_ptr<ax::Window>(_find_bar));
+
+		ax::TextBox::Info find_txt_info;
+		find_txt_info.normal = ax::Color(0.97);
+		find_txt_info.hover = find_txt_info.normal;
+		find_txt_info.selected = find_txt_info.normal;
+		find_txt_info.highlight = ax::Color(0.4f, 0.4f, 0.6f, 0.2f);
+		find_txt_info.contour = ax::Color(0.88);
+		find_txt_info.cursor = ax::Color(1.0f, 0.0f, 0.0f);
+		find_txt_info.selected_shadow = ax::Color(0.8f, 0.8f, 0.8f);
+		find_txt_info.font_color = ax::Color(0.0);
+
+		const ax::Size box_size(110, 19);
+		auto find_box = ax::shared<ax::TextBox>(
+			ax::Rect(ax::Point(0, 0), box_size), ax::TextBox::Events(), find_txt_info);
+		_find_box = find_box.get();
+		_find_bar->node.Add(find_box);
+		AttachHelpInfo(find_box->GetWindow(), "Text to find, regex when starting with 're:'.");
+
+		pos = find_box->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto replace_box
+			= ax::shared<ax::TextBox>(ax::Rect(pos, box_size), ax::TextBox::Events(), find_txt_info);
+		_replace_box = replace_box.get();
+		_find_bar->node.Add(replace_box);
+		AttachHelpInfo(replace_box->GetWindow(), "Replacement text.");
+
+		ax::Button::Info find_btn_info;
+		find_btn_info.normal = ax::Color(0.97);
+		find_btn_info.hover = ax::Color(0.99);
+		find_btn_info.clicking = ax::Color(0.96);
+		find_btn_info.selected = find_btn_info.normal;
+		find_btn_info.contour = ax::Color(0.88);
+		find_btn_info.font_color = ax::Color(0.0);
+		find_btn_info.corner_radius = 0;
+
+		const ax::Size btn_size(50, 19);
+		pos = replace_box->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto find_btn
+			= ax::shared<ax::Button>(ax::Rect(pos, btn_size), GetOnFind(), find_btn_info, "", "Find");
+		_find_bar->node.Add(find_btn);
+
+		pos = find_btn->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto replace_btn
+			= ax::shared<ax::Button>(ax::Rect(pos, btn_size), GetOnReplace(), find_btn_info, "", "Replace");
+		_find_bar->node.Add(replace_btn);
+
+		pos = replace_btn->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto all_btn
+			= ax::shared<ax::Button>(ax::Rect(pos, btn_size), GetOnReplaceAll(), find_btn_info, "", "All");
+		_find_bar->node.Add(all_btn);
+		AttachHelpInfo(all_btn->GetWindow(), "Replace all matches.");
+
+		// Console filter bar.
+		pos = _console_btn->GetWindow()->dimension.GetRect().GetNextPosRight(15);
+		_console_filter_bar = ax::Window::Create(ax::Rect(pos.x, 3, 270, 19));
+		win->node.Add(std::shared_ptr<ax::Window>(_console_filter_bar));
+		_console_filter_bar->Hide();
+
+		auto filter_box = ax::shared<ax::TextBox>(
+			ax::Rect(ax::Point(0, 0), ax::Size(160, 19)), ax::TextBox::Events(), find_txt_info);
+		_console_filter_box = filter_box.get();
+		_console_filter_bar->node.Add(filter_box);
+		AttachHelpInfo(filter_box->GetWindow(), "Only show console lines containing this text.");
+
+		pos = filter_box->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto filter_btn = ax::shared<ax::Button>(
+			ax::Rect(pos, btn_size), GetOnConsoleFilter(), find_btn_info, "", "Filter");
+		_console_filter_bar->node.Add(filter_btn);
+
+		pos = filter_btn->GetWindow()->dimension.GetRect().GetNextPosRight(4);
+		auto errors_btn = ax::shared<at::ColorButton>(
+			ax::Rect(pos, btn_size), GetOnConsoleErrors(), find_btn_info, "", "Errors");
+		_console_errors_btn = errors_btn.get();
+		_console_filter_bar->node.Add(errors_btn);
+		AttachHelpInfo(errors_btn->GetWindow(), "Only show errors and warnings.");
+	}
+
+	void BottomSection::ApplyConsoleFilter()
+	{
+		const std::string text = _console_filter_box->GetLabel();
+		const bool errors_only = _console_errors_btn->IsSelected();
+
+		if (text.empty() && !errors_only) {
+			_console->ClearFilter();
+			return;
+		}
+
+		int severity_mask = LogStore::ALL;
+
+		if (errors_only) {
+			severity_mask = (1 << LogStore::WARNING) | (1 << LogStore::ERROR);
+		}
+
+		_console->SetFilter(severity_mask, LogStore::ALL, text);
+	}
+
+	void BottomSection::OnConsoleFilter(const ax::Button::Msg& msg)
+	{
+		ApplyConsoleFilter();
+	}
+
+	void BottomSection::OnConsoleErrors(const ax::Button::Msg& msg)
+	{
+		_console_errors_btn->SetSelected(!_console_errors_btn->IsSelected());
+		ApplyConsoleFilter();
+	}
+
+	void BottomSection::OnFind(const ax::Button::Msg& msg)
+	{
+		std::string pattern = _find_box->GetLabel();
+		const bool regex = pattern.compare(0, 3, "re:") == 0;
+		_txt_editor->Find(regex ? pattern.substr(3) : pattern, regex);
+	}
+
+	void BottomSection::OnReplace(const ax::Button::Msg& msg)
+	{
+		std::string pattern = _find_box->GetLabel();
+		const bool regex = pattern.compare(0, 3, "re:") == 0;
+		_txt_editor->Replace(regex ? pattern.substr(3) : pattern, _replace_box->GetLabel(), regex);
+	}
+
+	void BottomSection::OnReplaceAll(const ax::Button::Msg& msg)
+	{
+		std::string pattern = _find_box->GetLabel();
+		const bool regex = pattern.compare(0, 3, "re:") == 0;
+		int n = _txt_editor->ReplaceAll(regex ? pattern.substr(3) : pattern, _replace_box->GetLabel(), regex);
+		ax::console::Print("Replaced", n, "matches.");
 	}
 
 	bool BottomSection::OpenFile(const std::string& path)
@@ -126,11 +256,18 @@ namespace editor {
 		return _file_path;
 	}
 
+	bool BottomSection::HasScriptError(int& line, std::string& msg) const
+	{
+		return _txt_editor->HasSyntaxError(line, msg);
+	}
+
 	void BottomSection::OnTextEditor(const ax::Button::Msg& msg)
 	{
 		_txt_editor->GetWindow()->Show();
+		_find_bar->Show();
 		_console->GetWindow()->Hide();
 		_console_clean_btn->GetWindow()->Hide();
+		_console_filter_bar->Hide();
 
 		if (!_is_txt_edit) {
 			_is_txt_edit = true;
@@ -140,10 +277,12 @@ namespace editor {
 		}
 	}
 
-	void BottomSection::OnConsole(const ax::Button::Msg& msg)
+	void BottomSection::ShowConsole()
 	{
 		_console->GetWindow()->Show();
+		_find_bar->Hide();
 		_console_clean_btn->GetWindow()->Show();
+		_console_filter_bar->Show();
 		_txt_editor->GetWindow()->Hide();
 
 		if (_is_txt_edit) {
@@ -154,6 +293,11 @@ namespace editor {
 		}
 	}
 
+	void BottomSection::OnConsole(const ax::Button::Msg& msg)
+	{
+		ShowConsole();
+	}
+
 	void BottomSection::OnConsoleClean(const ax::Button::Msg& msg)
 	{
 		_console->Clear();
@@ -161,16 +305,7 @@ namespace editor {
 
 	void BottomSection::OnConsoleErrorUpdate(const ax::event::EmptyMsg& msg)
 	{
-		_console->GetWindow()->Show();
-		_console_clean_btn->GetWindow()->Show();
-		_txt_editor->GetWindow()->Hide();
-
-		if (_is_txt_edit) {
-			_is_txt_edit = false;
-			_txt_btn->SetSelected(false);
-			_console_btn->SetSelected(true);
-			win->Update();
-		}
+		ShowConsole();
 	}
 
 	void BottomSection::OnMouseLeftDoubleClick(const ax::Point& pos)
@@ -315,6 +450,7 @@ namespace editor {
 		//		_save_btn->GetWindow()->dimension.SetPosition(pos);
 
 		_txt_editor->GetWindow()->dimension.SetSize(ax::Size(size.w - 1, size.h - TOP_BAR_HEIGHT));
+		_find_bar->dimension.SetPosition(ax::Point(size.w - FIND_BAR_WIDTH, 3));
 		_console->GetWindow()->dimension.SetSize(ax::Size(size.w - 1, size.h - TOP_BAR_HEIGHT));
 	}
 
@@ -27,6 +27,8 @@
 #include <axlib/NodeVisitor.hpp>
 #include <axlib/WindowManager.hpp>
 #include <axlib/Xml.hpp>
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 
 #include "PyoAudio.h"
@@ -81,6 +83,16 @@ namespace editor {
 		win->AddConnection(DROP_WIDGET_MENU, GetOnDropWidgetMenu());
 		win->AddConnection(BEGIN_DRAGGING_WIDGET, GetOnWidgetIsDragging());
 		win->AddConnection(DONE_DRAGGING_WIDGET, GetOnWidgetDoneDragging());
+		win->AddConnection(REPAINT_DAMAGE, GetOnRepaintDamage());
+
+		// Widgets added or removed (moved widgets are updated by GroupTransform).
+		const ax::event::Id index_evts[] = { DELETE_SELECTED_WIDGET, DUPLICATE_SELECTED_WIDGET,
+			DELETE_SELECTED_WIDGET_FROM_RIGHT_CLICK, DUPLICATE_SELECTED_WIDGET_FROM_RIGHT_CLICK };
+
+		for (auto& n : index_evts) {
+			win->AddConnection(
+				n, ax::event::Function([this](ax::event::Msg* msg) { InvalidateWidgetIndex(); }));
+		}
 
 		win->event.OnAssignToWindowManager = ax::WBind<int>(this, &GridWindow::OnAssignToWindowManager);
 
@@ -97,22 +109,6 @@ namespace editor {
 		loader->AddBuilder("Panel", new ax::Panel::Builder());
 		loader->AddBuilder("Slider", new ax::Slider::Builder());
 		loader->AddBuilder("Sprite", new ax::Sprite::Builder());
-
-		ax::Rect d_rect(win->dimension.GetDrawingRect());
-		_horizontal_lines_array.reserve((d_rect.size.h / _grid_space) * 2);
-		_vertical_lines_array.reserve((d_rect.size.w / _grid_space) * 2);
-
-		// Vertical lines.
-		for (int x = _grid_space; x < d_rect.size.w; x += _grid_space) {
-			_vertical_lines_array.push_back(ax::FPoint(x, 0));
-			_vertical_lines_array.push_back(ax::FPoint(x, d_rect.size.h));
-		}
-
-		// Horizontal lines.
-		for (int y = _grid_space; y < d_rect.size.h; y += _grid_space) {
-			_horizontal_lines_array.push_back(ax::FPoint(0, y));
-			_horizontal_lines_array.push_back(ax::FPoint(d_rect.size.w, y));
-		}
 	}
 
 	void GridWindow::OnAssignToWindowManager(const int& v)
@@ -231,9 +227,18 @@ namespace editor {
 		menu_info.item_height = 25;
 
 		std::vector<std::string> menu_elems = { "Save as", "Remove", "Duplicate", "", "Snap to grid" };
+		ax::Size menu_size(100, 200);
+
+		// Group operations.
+		if (App::GetInstance()->GetMainWindow()->GetSelectedWindows().size() > 1) {
+			const std::vector<std::string> group_elems = { "", "Align left", "Align right", "Align top",
+				"Align bottom", "Distribute horizontally", "Distribute vertically" };
+			menu_elems.insert(menu_elems.end(), group_elems.begin(), group_elems.end());
+			menu_size.w = 150;
+		}
 
 		auto menu = ax::shared<ax::DropMenu>(
-			ax::Rect(msg.GetMsg().first, ax::Size(100, 200)), GetOnMenuChoice(), menu_info, menu_elems);
+			ax::Rect(msg.GetMsg().first, menu_size), GetOnMenuChoice(), menu_info, menu_elems);
 
 		// Empty popup window tree.
 		ax::App::GetInstance().GetPopupManager()->Clear();
@@ -262,6 +267,10 @@ namespace editor {
 			win->PushEvent(SNAP_WIDGET_TO_GRID_FROM_RIGHT_CLICK, new ax::event::EmptyMsg());
 			ax::App::GetInstance().GetPopupManager()->Clear();
 		}
+		else if (choice.compare(0, 6, "Align ") == 0 || choice.compare(0, 11, "Distribute ") == 0) {
+			win->PushEvent(ALIGN_WIDGETS_FROM_RIGHT_CLICK, new ax::event::StringMsg(choice));
+			ax::App::GetInstance().GetPopupManager()->Clear();
+		}
 	}
 
 	void GridWindow::OnGlobalClick(const ax::Window::Event::GlobalClick& gclick)
@@ -277,6 +286,8 @@ namespace editor {
 
 	std::string GridWindow::OpenLayout(const std::string& path)
 	{
+		_journal.Clear();
+		InvalidateWidgetIndex();
 		at::editor::Loader loader(win);
 		return loader.OpenLayout(path, true);
 	}
@@ -284,7 +295,7 @@ namespace editor {
 	void GridWindow::SetBackgroundColor(const ax::Color& color)
 	{
 		_bg_color = color;
-		win->Update();
+		InvalidateAll();
 	}
 
 	ax::Window* GetWidgetByNameRecursive(ax::Window* window, const std::string& name)
@@ -340,26 +351,373 @@ namespace editor {
 	{
 		space = ax::util::Clamp<int>(space, 5, 20);
 		_grid_space = space;
+		_lines_dirty = true;
+
+		InvalidateAll();
+	}
+
+	void GridWindow::InvalidateWidgetIndex()
+	{
+		_widget_index_dirty = true;
+	}
+
+	void GridWindow::AddToWidgetIndex(ax::Window* window, bool update)
+	{
+		if (window->component.Has("Widget")) {
+			ax::Rect rect(window->dimension.GetAbsoluteRect());
+			rect.position -= win->dimension.GetAbsoluteRect().position;
+
+			if (update) {
+				_widget_index.Update(window, rect);
+			}
+			else {
+				_widget_index.Insert(window, rect);
+			}
+		}
+
+		if (window->property.HasProperty("AcceptWidget")) {
+			for (auto& n : window->node.GetChildren()) {
+				AddToWidgetIndex(n.get(), update);
+			}
+		}
+	}
+
+	void GridWindow::RebuildWidgetIndex()
+	{
+		_widget_index.Clear(ax::Rect(ax::Point(0, 0), win->dimension.GetSize()));
+
+		for (auto& n : win->node.GetChildren()) {
+			AddToWidgetIndex(n.get(), false);
+		}
+
+		_widget_index_dirty = false;
+		_guide_widget = nullptr;
+	}
+
+	void GridWindow::UpdateWidgetIndex(ax::Window* widget)
+	{
+		// Everything is reinserted on next query anyway.
+		if (_widget_index_dirty) {
+			InvalidateAll();
+			return;
+		}
+
+		ax::Rect old_rect;
+		const bool has_old_rect = _widget_index.GetRect(widget, old_rect);
+
+		AddToWidgetIndex(widget, true);
+
+		ax::Rect rect;
+		if (_widget_index.GetRect(widget, rect)) {
+			// Selection contour and resize handles are drawn around the widget.
+			Invalidate(ax::Rect(rect.position.x - 4, rect.position.y - 4, rect.size.w + 8, rect.size.h + 8));
+
+			if (has_old_rect) {
+				Invalidate(ax::Rect(old_rect.position.x - 4, old_rect.position.y - 4, old_rect.size.w + 8,
+					old_rect.size.h + 8));
+			}
+		}
+	}
+
+	ax::Rect GetPositiveRect(const ax::Rect& rect)
+	{
+		ax::Rect r(rect);
+
+		if (r.size.w < 0) {
+			r.position.x += r.size.w;
+			r.size.w = -r.size.w;
+		}
+
+		if (r.size.h < 0) {
+			r.position.y += r.size.h;
+			r.size.h = -r.size.h;
+		}
+
+		return r;
+	}
+
+	void GridWindow::Invalidate(const ax::Rect& rect)
+	{
+		const ax::Rect r(GetPositiveRect(rect));
+
+		if (r.size.w == 0 || r.size.h == 0) {
+			return;
+		}
+
+		if (_has_damage) {
+			const int left = std::min(_damage.position.x, r.position.x);
+			const int top = std::min(_damage.position.y, r.position.y);
+			const int right = std::max(_damage.position.x + _damage.size.w, r.position.x + r.size.w);
+			const int bottom = std::max(_damage.position.y + _damage.size.h, r.position.y + r.size.h);
+			_damage = ax::Rect(left, top, right - left, bottom - top);
+		}
+		else {
+			_damage = r;
+			_has_damage = true;
+		}
+
+		if (!_repaint_pending) {
+			_repaint_pending = true;
+			win->PushEvent(REPAINT_DAMAGE, new ax::event::EmptyMsg());
+		}
+	}
+
+	void GridWindow::InvalidateAll()
+	{
+		Invalidate(ax::Rect(ax::Point(0, 0), win->dimension.GetSize()));
+	}
+
+	void GridWindow::OnRepaintDamage(const ax::event::EmptyMsg& msg)
+	{
+		_repaint_pending = false;
+
+		if (!_has_damage) {
+			return;
+		}
+
+		_has_damage = false;
+
+		// Nothing to draw when damaged area was scrolled out of view.
+		if (WidgetIndex::Intersects(_damage, GetVisibleRect())) {
+			win->Update();
+		}
+	}
+
+	std::vector<ax::Window*> GridWindow::FindWidgets(const ax::Rect& rect)
+	{
+		if (_widget_index_dirty) {
+			RebuildWidgetIndex();
+		}
+
+		std::vector<ax::Window*> widgets;
+		_widget_index.FindIntersecting(rect, widgets);
+		return widgets;
+	}
+
+	ax::Window* GridWindow::FindWidget(const ax::Point& pos)
+	{
+		if (_widget_index_dirty) {
+			RebuildWidgetIndex();
+		}
+
+		std::vector<ax::Window*> widgets;
+		_widget_index.FindContaining(pos, widgets);
+
+		ax::Window* widget = nullptr;
+		int widget_area = 0;
+
+		// Nested widgets are smaller than their parent.
+		for (auto& n : widgets) {
+			ax::Rect rect;
+			_widget_index.GetRect(n, rect);
+			const int area = rect.size.w * rect.size.h;
+
+			if (widget == nullptr || area < widget_area) {
+				widget = n;
+				widget_area = area;
+			}
+		}
+
+		return widget;
+	}
+
+	ax::Point GridWindow::FindClosestGridPosition(const ax::Point& pos) const
+	{
+		const ax::Size size(win->dimension.GetSize());
+
+		// Last grid line inside the window.
+		const int last_x = std::max(0, ((size.w - 1) / _grid_space) * _grid_space);
+		const int last_y = std::max(0, ((size.h - 1) / _grid_space) * _grid_space);
+
+		const int x = pos.x < _grid_space ? 0 : std::min((pos.x / _grid_space) * _grid_space, last_x);
+		const int y = pos.y < _grid_space ? 0 : std::min((pos.y / _grid_space) * _grid_space, last_y);
+
+		return ax::Point(x, y);
+	}
+
+	bool IsSameOrChildOf(ax::Window* window, ax::Window* parent)
+	{
+		for (; window != nullptr; window = window->node.GetParent()) {
+			if (window == parent) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void GridWindow::RebuildGuideEdges()
+	{
+		std::vector<ax::Window*> widgets;
+		_widget_index.GetWidgets(widgets);
+
+		_guide_x_edges.clear();
+		_guide_y_edges.clear();
+		_guide_x_edges.reserve(widgets.size() * 3);
+		_guide_y_edges.reserve(widgets.size() * 3);
+
+		for (auto& n : widgets) {
+			ax::Rect rect;
+			_widget_index.GetRect(n, rect);
+
+			_guide_x_edges.push_back(GuideEdge{ rect.position.x, n });
+			_guide_x_edges.push_back(GuideEdge{ rect.position.x + rect.size.w / 2, n });
+			_guide_x_edges.push_back(GuideEdge{ rect.position.x + rect.size.w, n });
+
+			_guide_y_edges.push_back(GuideEdge{ rect.position.y, n });
+			_guide_y_edges.push_back(GuideEdge{ rect.position.y + rect.size.h / 2, n });
+			_guide_y_edges.push_back(GuideEdge{ rect.position.y + rect.size.h, n });
+		}
+
+		std::sort(_guide_x_edges.begin(), _guide_x_edges.end());
+		std::sort(_guide_y_edges.begin(), _guide_y_edges.end());
+	}
+
+	bool GridWindow::FindGuideEdge(const std::vector<GuideEdge>& edges, ax::Window* widget,
+		const int values[3], int& delta, int& edge) const
+	{
+		int distance = GUIDE_DISTANCE + 1;
+
+		for (int i = 0; i < 3; i++) {
+			const GuideEdge low = { values[i] - GUIDE_DISTANCE, nullptr };
+			auto it = std::lower_bound(edges.begin(), edges.end(), low);
+
+			for (; it != edges.end() && it->value <= values[i] + GUIDE_DISTANCE; ++it) {
+				const int d = it->value - values[i];
+
+				if (std::abs(d) < distance && !IsSameOrChildOf(it->widget, widget)) {
+					distance = std::abs(d);
+					delta = d;
+					edge = it->value;
+				}
+			}
+		}
+
+		return distance <= GUIDE_DISTANCE;
+	}
+
+	ax::Point GridWindow::FindGuidePosition(ax::Window* widget, const ax::Rect& rect)
+	{
+		if (_widget_index_dirty) {
+			RebuildWidgetIndex();
+		}
+
+		// Only the dragged widget edges get outdated while it moves.
+		if (widget != _guide_widget) {
+			RebuildGuideEdges();
+			_guide_widget = widget;
+		}
+
+		const ax::Point& p(rect.position);
+		const int x_values[3] = { p.x, p.x + rect.size.w / 2, p.x + rect.size.w };
+		const int y_values[3] = { p.y, p.y + rect.size.h / 2, p.y + rect.size.h };
+
+		ax::Point pos(p);
+		int guide_x = -1;
+		int guide_y = -1;
+		int delta = 0;
+
+		if (FindGuideEdge(_guide_x_edges, widget, x_values, delta, guide_x)) {
+			pos.x += delta;
+		}
+
+		if (FindGuideEdge(_guide_y_edges, widget, y_values, delta, guide_y)) {
+			pos.y += delta;
+		}
+
+		if (guide_x != _guide_x || guide_y != _guide_y) {
+			InvalidateGuides();
+			_guide_x = guide_x;
+			_guide_y = guide_y;
+			InvalidateGuides();
+		}
+
+		return pos;
+	}
+
+	void GridWindow::ClearGuides()
+	{
+		_guide_widget = nullptr;
+
+		if (_guide_x != -1 || _guide_y != -1) {
+			InvalidateGuides();
+			_guide_x = -1;
+			_guide_y = -1;
+		}
+	}
+
+	void GridWindow::InvalidateGuides()
+	{
+		const ax::Size size(win->dimension.GetSize());
+
+		if (_guide_x != -1) {
+			Invalidate(ax::Rect(_guide_x - 1, 0, 3, size.h));
+		}
+
+		if (_guide_y != -1) {
+			Invalidate(ax::Rect(0, _guide_y - 1, size.w, 3));
+		}
+	}
+
+	void GridWindow::InvalidateSelection()
+	{
+		// Contour is drawn on the rect border.
+		const ax::Rect rect(GetPositiveRect(_selection.second));
+		Invalidate(ax::Rect(rect.position.x - 1, rect.position.y - 1, rect.size.w + 2, rect.size.h + 2));
+	}
+
+	ax::Rect GridWindow::GetVisibleRect() const
+	{
+		const ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
+		ax::Window* parent = win->node.GetParent();
+
+		if (parent == nullptr) {
+			return ax::Rect(ax::Point(0, 0), abs_rect.size);
+		}
+
+		const ax::Rect p_rect(parent->dimension.GetAbsoluteRect());
+		const int left = std::max(abs_rect.position.x, p_rect.position.x);
+		const int top = std::max(abs_rect.position.y, p_rect.position.y);
+		const int right = std::min(abs_rect.position.x + abs_rect.size.w, p_rect.position.x + p_rect.size.w);
+		const int bottom = std::min(abs_rect.position.y + abs_rect.size.h, p_rect.position.y + p_rect.size.h);
+
+		return ax::Rect(left - abs_rect.position.x, top - abs_rect.position.y, std::max(0, right - left),
+			std::max(0, bottom - top));
+	}
+
+	void GridWindow::UpdateGridLines()
+	{
+		const ax::Rect rect(GetVisibleRect());
+
+		if (!_lines_dirty && rect.position == _lines_rect.position && rect.size.w == _lines_rect.size.w
+			&& rect.size.h == _lines_rect.size.h) {
+			return;
+		}
+
+		_lines_dirty = false;
+		_lines_rect = rect;
+
+		const int x_end = rect.position.x + rect.size.w;
+		const int y_end = rect.position.y + rect.size.h;
+
+		// First grid line inside visible area.
+		const int x_begin = std::max(1, (rect.position.x + _grid_space - 1) / _grid_space) * _grid_space;
+		const int y_begin = std::max(1, (rect.position.y + _grid_space - 1) / _grid_space) * _grid_space;
 
-		ax::Rect d_rect(win->dimension.GetDrawingRect());
 		_horizontal_lines_array.clear();
 		_vertical_lines_array.clear();
-		_horizontal_lines_array.reserve((d_rect.size.h / _grid_space) * 2);
-		_vertical_lines_array.reserve((d_rect.size.w / _grid_space) * 2);
 
 		// Vertical lines.
-		for (int x = _grid_space; x < d_rect.size.w; x += _grid_space) {
-			_vertical_lines_array.push_back(ax::FPoint(x, 0));
-			_vertical_lines_array.push_back(ax::FPoint(x, d_rect.size.h));
+		for (int x = x_begin; x < x_end; x += _grid_space) {
+			_vertical_lines_array.push_back(ax::FPoint(x, rect.position.y));
+			_vertical_lines_array.push_back(ax::FPoint(x, y_end));
 		}
 
 		// Horizontal lines.
-		for (int y = _grid_space; y < d_rect.size.h; y += _grid_space) {
-			_horizontal_lines_array.push_back(ax::FPoint(0, y));
-			_horizontal_lines_array.push_back(ax::FPoint(d_rect.size.w, y));
+		for (int y = y_begin; y < y_end; y += _grid_space) {
+			_horizontal_lines_array.push_back(ax::FPoint(rect.position.x, y));
+			_horizontal_lines_array.push_back(ax::FPoint(x_end, y));
 		}
-
-		win->Update();
 	}
 
 	void GridWindow::OnBackSpaceDown(const char& c)
@@ -383,6 +741,12 @@ namespace editor {
 			if (c == 'd' || c == 'D') {
 				win->PushEvent(DUPLICATE_SELECTED_WIDGET, new ax::event::EmptyMsg());
 			}
+			else if (c == 'z') {
+				Undo();
+			}
+			else if (c == 'Z' || c == 'y' || c == 'Y') {
+				Redo();
+			}
 		}
 	}
 
@@ -425,7 +789,7 @@ namespace editor {
 			_selection.second.size = ax::Size(1, 1);
 
 			win->event.GrabMouse();
-			win->Update();
+			InvalidateSelection();
 		}
 	}
 
@@ -448,28 +812,74 @@ namespace editor {
 		for (auto& n : children) {
 			UnselectAllChildWidget(n);
 		}
-		win->Update();
+		InvalidateAll();
+	}
+
+	bool GridWindow::Undo()
+	{
+		if (!_journal.CanUndo()) {
+			return false;
+		}
+
+		// Selected widgets may be removed.
+		UnSelectAllWidgets();
+		win->PushEvent(UNSELECT_ALL, new ax::event::SimpleMsg<int>(0));
+
+		_journal.Undo();
+		RefreshAfterUndoRedo();
+		return true;
+	}
+
+	bool GridWindow::Redo()
+	{
+		if (!_journal.CanRedo()) {
+			return false;
+		}
+
+		UnSelectAllWidgets();
+		win->PushEvent(UNSELECT_ALL, new ax::event::SimpleMsg<int>(0));
+
+		_journal.Redo();
+		RefreshAfterUndoRedo();
+		return true;
+	}
+
+	void GridWindow::RefreshAfterUndoRedo()
+	{
+		InvalidateWidgetIndex();
+		InvalidateAll();
+		win->PushEvent(LAYOUT_UNDO_REDO, new ax::event::EmptyMsg());
 	}
 
 	void GridWindow::OnWidgetIsDragging(const ax::event::EmptyMsg& msg)
 	{
 		if (_draw_grid_over_children == false) {
 			_draw_grid_over_children = true;
-			win->Update();
+			InvalidateAll();
 		}
 	}
 
 	void GridWindow::OnWidgetDoneDragging(const ax::event::EmptyMsg& msg)
 	{
+		_journal.BreakMerging();
 		_draw_grid_over_children = false;
-		win->Update();
+		ClearGuides();
+		InvalidateAll();
 	}
 
 	void GridWindow::OnMouseLeftDragging(const ax::Point& pos)
 	{
 		ax::Point m_pos(pos - win->dimension.GetAbsoluteRect().position);
-		_selection.second.size = ax::Size((m_pos - _selection.second.position).ToPair());
-		win->Update();
+		const ax::Size size((m_pos - _selection.second.position).ToPair());
+
+		if (size.w == _selection.second.size.w && size.h == _selection.second.size.h) {
+			return;
+		}
+
+		// Previous and new selection rect.
+		InvalidateSelection();
+		_selection.second.size = size;
+		InvalidateSelection();
 	}
 
 	void GridWindow::OnMouseLeftUp(const ax::Point& pos)
@@ -490,55 +900,40 @@ namespace editor {
 
 			// Look for selected widget.
 			if (_selection.second.size.w > 0 && _selection.second.size.h > 0) {
-				ax::Rect selection_rect = _selection.second;
+				const ax::Rect selection_rect = _selection.second;
+				std::vector<ax::Window*> selected;
 
-				selection_rect.position += win->dimension.GetAbsoluteRect().position;
+				for (auto& n : FindWidgets(selection_rect)) {
+					ax::Rect rect;
+					_widget_index.GetRect(n, rect);
 
-				std::vector<ax::Window*> selected
-					= ax::NodeVisitor::AccumulateFromChild(win, [selection_rect](ax::Window* window) {
-						  const ax::Rect abs_rect(window->dimension.GetAbsoluteRect());
-
-						  if (selection_rect.IsPointInside(abs_rect.position)) {
-							  return true;
-						  }
-
-						  return false;
-					  });
+					// Containers in which the selection was made are not selected.
+					if (!WidgetIndex::Contains(rect, selection_rect)) {
+						selected.push_back(n);
+					}
+				}
 
 				win->PushEvent(
 					SELECT_MULTIPLE_WIDGET, new ax::event::SimpleMsg<std::vector<ax::Window*>>(selected));
 			}
 
 			_selection.first = false;
-			win->Update();
+			InvalidateSelection();
 		}
 	}
 
 	void GridWindow::OnResize(const ax::Size& size)
 	{
-		ax::Rect d_rect(win->dimension.GetDrawingRect());
-		_horizontal_lines_array.clear();
-		_vertical_lines_array.clear();
-		_horizontal_lines_array.reserve((d_rect.size.h / _grid_space) * 2);
-		_vertical_lines_array.reserve((d_rect.size.w / _grid_space) * 2);
-
-		// Vertical lines.
-		for (int x = _grid_space; x < d_rect.size.w; x += _grid_space) {
-			_vertical_lines_array.push_back(ax::FPoint(x, 0));
-			_vertical_lines_array.push_back(ax::FPoint(x, d_rect.size.h));
-		}
-
-		// Horizontal lines.
-		for (int y = _grid_space; y < d_rect.size.h; y += _grid_space) {
-			_horizontal_lines_array.push_back(ax::FPoint(0, y));
-			_horizontal_lines_array.push_back(ax::FPoint(d_rect.size.w, y));
-		}
+		InvalidateWidgetIndex();
+		_lines_dirty = true;
 	}
 
 	void GridWindow::OnPaintOverChildren(ax::GC gc)
 	{
 		// Draw lines over children widgets.
 		if (_draw_grid_over_children) {
+			UpdateGridLines();
+
 			ax::Color line_color(at::Skin::GetInstance()->data.grid_window_lines);
 			line_color.SetAlpha(0.1);
 			gc.SetColor(line_color);
@@ -546,6 +941,20 @@ namespace editor {
 			gc.DrawLines(_vertical_lines_array);
 		}
 
+		// Smart guides.
+		if (_guide_x != -1 || _guide_y != -1) {
+			const ax::Size size(win->dimension.GetSize());
+			gc.SetColor(ax::Color(1.0f, 0.0f, 1.0f, 0.7f));
+
+			if (_guide_x != -1) {
+				gc.DrawLine(ax::Point(_guide_x, 0), ax::Point(_guide_x, size.h));
+			}
+
+			if (_guide_y != -1) {
+				gc.DrawLine(ax::Point(0, _guide_y), ax::Point(size.w, _guide_y));
+			}
+		}
+
 		// Selection rectangle.
 		if (_selection.first) {
 			gc.SetColor(ax::Color(0.8, 0.2));
@@ -563,6 +972,7 @@ namespace editor {
 		gc.SetColor(_bg_color);
 		gc.DrawRectangle(rect);
 
+		UpdateGridLines();
 		gc.SetColor(at::Skin::GetInstance()->data.grid_window_lines);
 		gc.DrawLines(_horizontal_lines_array);
 		gc.DrawLines(_vertical_lines_array);
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/atEditorGroupTransform.hpp"
+#include "editor/atEditorGridWindow.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace at {
+namespace editor {
+	bool HasAncestorIn(ax::Window* widget, const std::vector<ax::Window*>& widgets)
+	{
+		for (ax::Window* w = widget->node.GetParent(); w != nullptr; w = w->node.GetParent()) {
+			if (std::find(widgets.begin(), widgets.end(), w) != widgets.end()) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	GroupTransform::GroupTransform(GridWindow* grid, const std::vector<ax::Window*>& widgets)
+		: _grid(grid)
+	{
+		const ax::Point gw_abs_pos(_grid->GetWindow()->dimension.GetAbsoluteRect().position);
+		_entries.reserve(widgets.size());
+
+		for (auto& n : widgets) {
+			if (HasAncestorIn(n, widgets)) {
+				continue;
+			}
+
+			ax::Rect rect(n->dimension.GetAbsoluteRect());
+			rect.position -= gw_abs_pos;
+			_entries.push_back(Entry{ n, rect, rect });
+		}
+	}
+
+	void GroupTransform::Translate(const ax::Point& delta)
+	{
+		for (auto& n : _entries) {
+			n.rect.position += delta;
+		}
+	}
+
+	void GroupTransform::Scale(double x_scale, double y_scale)
+	{
+		const ax::Point origin(GetBoundingRect().position);
+
+		for (auto& n : _entries) {
+			const ax::Point d(n.rect.position - origin);
+			n.rect.position.x = origin.x + (int)std::round(d.x * x_scale);
+			n.rect.position.y = origin.y + (int)std::round(d.y * y_scale);
+			n.rect.size.w = std::max(1, (int)std::round(n.rect.size.w * x_scale));
+			n.rect.size.h = std::max(1, (int)std::round(n.rect.size.h * y_scale));
+		}
+	}
+
+	void GroupTransform::Align(Alignment alignment)
+	{
+		const ax::Rect bounds(GetBoundingRect());
+
+		for (auto& n : _entries) {
+			ax::Rect& r(n.rect);
+
+			switch (alignment) {
+			case Alignment::LEFT:
+				r.position.x = bounds.position.x;
+				break;
+			case Alignment::HORIZONTAL_CENTER:
+				r.position.x = bounds.position.x + (bounds.size.w - r.size.w) / 2;
+				break;
+			case Alignment::RIGHT:
+				r.position.x = bounds.position.x + bounds.size.w - r.size.w;
+				break;
+			case Alignment::TOP:
+				r.position.y = bounds.position.y;
+				break;
+			case Alignment::VERTICAL_CENTER:
+				r.position.y = bounds.position.y + (bounds.size.h - r.size.h) / 2;
+				break;
+			case Alignment::BOTTOM:
+				r.position.y = bounds.position.y + bounds.size.h - r.size.h;
+				break;
+			}
+		}
+	}
+
+	void GroupTransform::Distribute(Distribution distribution)
+	{
+		if (_entries.size() < 3) {
+			return;
+		}
+
+		const bool horizontal = distribution == Distribution::HORIZONTAL;
+		const ax::Rect bounds(GetBoundingRect());
+
+		std::vector<Entry*> sorted;
+		sorted.reserve(_entries.size());
+		int total = 0;
+
+		for (auto& n : _entries) {
+			sorted.push_back(&n);
+			total += horizontal ? n.rect.size.w : n.rect.size.h;
+		}
+
+		std::sort(sorted.begin(), sorted.end(), [horizontal](const Entry* a, const Entry* b) {
+			return horizontal ? a->rect.position.x < b->rect.position.x
+							  : a->rect.position.y < b->rect.position.y;
+		});
+
+		// Same space between each widget (may be negative when they overlap).
+		const double space = ((horizontal ? bounds.size.w : bounds.size.h) - total)
+			/ double(sorted.size() - 1);
+		double pos = horizontal ? bounds.position.x : bounds.position.y;
+
+		for (auto& n : sorted) {
+			if (horizontal) {
+				n->rect.position.x = (int)std::round(pos);
+				pos += n->rect.size.w + space;
+			}
+			else {
+				n->rect.position.y = (int)std::round(pos);
+				pos += n->rect.size.h + space;
+			}
+		}
+	}
+
+	void GroupTransform::SnapToGrid()
+	{
+		for (auto& n : _entries) {
+			n.rect.position = _grid->FindClosestGridPosition(n.rect.position);
+		}
+	}
+
+	ax::Rect GroupTransform::GetBoundingRect() const
+	{
+		if (_entries.empty()) {
+			return ax::Rect(0, 0, 0, 0);
+		}
+
+		int left = _entries[0].rect.position.x;
+		int top = _entries[0].rect.position.y;
+		int right = left + _entries[0].rect.size.w;
+		int bottom = top + _entries[0].rect.size.h;
+
+		for (auto& n : _entries) {
+			left = std::min(left, n.rect.position.x);
+			top = std::min(top, n.rect.position.y);
+			right = std::max(right, n.rect.position.x + n.rect.size.w);
+			bottom = std::max(bottom, n.rect.position.y + n.rect.size.h);
+		}
+
+		return ax::Rect(left, top, right - left, bottom - top);
+	}
+
+	void GroupTransform::Commit(int flags)
+	{
+		const ax::Point gw_abs_pos(_grid->GetWindow()->dimension.GetAbsoluteRect().position);
+		LayoutJournal::Entry journal_entry;
+
+		for (auto& n : _entries) {
+			const bool moved = !(n.rect.position == n.old_rect.position);
+			const bool resized = n.rect.size.w != n.old_rect.size.w || n.rect.size.h != n.old_rect.size.h;
+
+			if (!moved && !resized) {
+				continue;
+			}
+
+			// Back to parent coordinates.
+			ax::Window* parent = n.widget->node.GetParent();
+			const ax::Point pos(n.rect.position + gw_abs_pos - parent->dimension.GetAbsoluteRect().position);
+			journal_entry.push_back(LayoutJournal::CreateRectEdit(
+				n.widget, n.widget->dimension.GetRect(), ax::Rect(pos, n.rect.size)));
+
+			if (resized) {
+				n.widget->dimension.SetRect(ax::Rect(pos, n.rect.size));
+			}
+			else {
+				n.widget->dimension.SetPosition(pos);
+			}
+
+			_grid->UpdateWidgetIndex(n.widget);
+			n.old_rect = n.rect;
+		}
+
+		if (journal_entry.empty()) {
+			return;
+		}
+
+		if (flags & RECORD_UNDO) {
+			_grid->GetJournal().Record(std::move(journal_entry), (flags & MERGE_UNDO) != 0);
+		}
+
+		if (flags & PUSH_EVENT) {
+			_grid->GetWindow()->PushEvent(GridWindow::WIDGETS_TRANSFORMED, new ax::event::EmptyMsg());
+		}
+	}
+}
+}
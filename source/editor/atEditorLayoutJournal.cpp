@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/atEditorLayoutJournal.hpp"
+#include <algorithm>
+
+namespace at {
+namespace editor {
+	bool IsSameRect(const ax::Rect& a, const ax::Rect& b)
+	{
+		return a.position == b.position && a.size.w == b.size.w && a.size.h == b.size.h;
+	}
+
+	LayoutJournal::LayoutJournal()
+		: _index(0)
+		, _can_merge(false)
+	{
+	}
+
+	LayoutJournal::Edit LayoutJournal::CreateRectEdit(
+		ax::Window* widget, const ax::Rect& old_rect, const ax::Rect& new_rect)
+	{
+		Edit edit;
+		edit.type = Edit::RECT;
+		edit.widget = widget;
+		edit.old_rect = old_rect;
+		edit.new_rect = new_rect;
+		edit.parent = nullptr;
+		edit.index = 0;
+		return edit;
+	}
+
+	void LayoutJournal::Record(Entry entry, bool merge)
+	{
+		if (entry.empty()) {
+			return;
+		}
+
+		// Drop redo history (windows of undone add are released here).
+		while (_entries.size() > _index) {
+			_entries.pop_back();
+		}
+
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		const bool is_recent = now - _last_record < std::chrono::milliseconds(MERGE_DELAY_MS);
+		_last_record = now;
+
+		if (merge && _can_merge && is_recent && !_entries.empty() && Merge(_entries.back(), entry)) {
+			return;
+		}
+
+		_entries.push_back(std::move(entry));
+		_index = _entries.size();
+
+		// Only mergeable edits can be continued.
+		_can_merge = merge;
+
+		// Drop oldest entries.
+		while (_entries.size() > MAX_ENTRIES) {
+			_entries.pop_front();
+			_index--;
+		}
+	}
+
+	bool LayoutJournal::Merge(Entry& last, const Entry& entry) const
+	{
+		if (last.size() != entry.size()) {
+			return false;
+		}
+
+		for (std::size_t i = 0; i < entry.size(); i++) {
+			const Edit& a = last[i];
+			const Edit& b = entry[i];
+
+			if (a.type != b.type || a.widget != b.widget) {
+				return false;
+			}
+
+			if (a.type == Edit::ADD || a.type == Edit::REMOVE || (a.type != Edit::RECT && a.name != b.name)) {
+				return false;
+			}
+		}
+
+		// Keep first old values and last new values.
+		for (std::size_t i = 0; i < entry.size(); i++) {
+			last[i].new_rect = entry[i].new_rect;
+			last[i].new_value = entry[i].new_value;
+		}
+
+		return true;
+	}
+
+	void LayoutJournal::BeginRectEdit(const std::vector<ax::Window*>& widgets)
+	{
+		_rect_edit.clear();
+
+		for (auto& n : widgets) {
+			const ax::Rect rect(n->dimension.GetRect());
+			_rect_edit.push_back(CreateRectEdit(n, rect, rect));
+		}
+	}
+
+	void LayoutJournal::EndRectEdit()
+	{
+		Entry entry;
+
+		for (auto& n : _rect_edit) {
+			n.new_rect = n.widget->dimension.GetRect();
+
+			if (!IsSameRect(n.old_rect, n.new_rect)) {
+				entry.push_back(n);
+			}
+		}
+
+		_rect_edit.clear();
+		Record(std::move(entry));
+	}
+
+	void LayoutJournal::RecordAttribute(ax::Window* widget, Edit::Type type, const std::string& name,
+		const std::string& old_value, const std::string& new_value)
+	{
+		if (old_value == new_value) {
+			return;
+		}
+
+		Edit edit;
+		edit.type = type;
+		edit.widget = widget;
+		edit.name = name;
+		edit.old_value = old_value;
+		edit.new_value = new_value;
+		edit.parent = nullptr;
+		edit.index = 0;
+
+		// Values dragged with a number scroll are merged in one entry.
+		Record(Entry(1, edit), true);
+	}
+
+	void LayoutJournal::RecordAdd(ax::Window* widget)
+	{
+		RecordAdd(std::vector<ax::Window*>(1, widget));
+	}
+
+	void LayoutJournal::RecordAdd(const std::vector<ax::Window*>& widgets)
+	{
+		Entry entry;
+
+		for (auto& n : widgets) {
+			Edit edit;
+			edit.type = Edit::ADD;
+			edit.widget = n;
+			edit.parent = n->node.GetParent();
+			edit.index = 0;
+
+			if (edit.parent == nullptr) {
+				continue;
+			}
+
+			std::vector<std::shared_ptr<ax::Window>>& children = edit.parent->node.GetChildren();
+
+			for (std::size_t i = 0; i < children.size(); i++) {
+				if (children[i].get() == n) {
+					edit.window = children[i];
+					edit.index = i;
+					entry.push_back(edit);
+					break;
+				}
+			}
+		}
+
+		Record(std::move(entry));
+	}
+
+	void LayoutJournal::RemoveWidgets(const std::vector<ax::Window*>& widgets)
+	{
+		Entry entry;
+
+		for (auto& n : widgets) {
+			Edit edit;
+			edit.type = Edit::REMOVE;
+			edit.widget = n;
+			edit.parent = n->node.GetParent();
+			edit.index = 0;
+
+			if (edit.parent == nullptr) {
+				continue;
+			}
+
+			Detach(edit);
+			entry.push_back(edit);
+		}
+
+		Record(std::move(entry));
+	}
+
+	bool LayoutJournal::Undo()
+	{
+		_can_merge = false;
+
+		if (_index == 0) {
+			return false;
+		}
+
+		_index--;
+		Entry& entry = _entries[_index];
+
+		for (auto it = entry.rbegin(); it != entry.rend(); ++it) {
+			Apply(*it, true);
+		}
+
+		return true;
+	}
+
+	bool LayoutJournal::Redo()
+	{
+		_can_merge = false;
+
+		if (_index == _entries.size()) {
+			return false;
+		}
+
+		Entry& entry = _entries[_index];
+		_index++;
+
+		for (auto& n : entry) {
+			Apply(n, false);
+		}
+
+		return true;
+	}
+
+	void LayoutJournal::Clear()
+	{
+		_entries.clear();
+		_rect_edit.clear();
+		_index = 0;
+		_can_merge = false;
+	}
+
+	void LayoutJournal::Apply(Edit& edit, bool undo)
+	{
+		switch (edit.type) {
+		case Edit::RECT:
+			edit.widget->dimension.SetRect(undo ? edit.old_rect : edit.new_rect);
+			break;
+
+		case Edit::BUILDER_ATTRIBUTE: {
+			ax::widget::Component::Ptr widget = edit.widget->component.Get<ax::widget::Component>("Widget");
+			widget->SetBuilderAttributes(std::vector<std::pair<std::string, std::string>>{
+				{ edit.name, undo ? edit.old_value : edit.new_value } });
+		} break;
+
+		case Edit::INFO_ATTRIBUTE: {
+			ax::widget::Component::Ptr widget = edit.widget->component.Get<ax::widget::Component>("Widget");
+			widget->SetInfo(std::vector<std::pair<std::string, std::string>>{
+				{ edit.name, undo ? edit.old_value : edit.new_value } });
+			widget->ReloadInfo();
+		} break;
+
+		case Edit::ADD:
+			undo ? Detach(edit) : Attach(edit);
+			break;
+
+		case Edit::REMOVE:
+			undo ? Attach(edit) : Detach(edit);
+			break;
+		}
+	}
+
+	void LayoutJournal::Attach(Edit& edit)
+	{
+		edit.parent->node.Add(edit.window);
+
+		// Restore drawing order.
+		std::vector<std::shared_ptr<ax::Window>>& children = edit.parent->node.GetChildren();
+
+		if (edit.index + 1 < children.size()) {
+			std::rotate(children.begin() + edit.index, children.end() - 1, children.end());
+		}
+	}
+
+	void LayoutJournal::Detach(Edit& edit)
+	{
+		std::vector<std::shared_ptr<ax::Window>>& children = edit.parent->node.GetChildren();
+
+		for (std::size_t i = 0; i < children.size(); i++) {
+			if (children[i].get() == edit.widget) {
+				edit.window = children[i];
+				edit.index = i;
+				edit.widget->RemoveWindow();
+				return;
+			}
+		}
+	}
+}
+}
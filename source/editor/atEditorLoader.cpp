@@ -29,6 +29,7 @@
 #include "atUniqueNameComponent.h"
 #include "atWindowEventsComponent.hpp"
 #include "editor/atEditor.hpp"
+#include "editor/atEditorGroupTransform.hpp"
 #include "editor/atEditorMainWindow.hpp"
 #include "python/PyUtils.hpp"
 #include "python/PyoComponent.hpp"
@@ -74,8 +75,9 @@ namespace editor {
 		ax::Xml::Node node = top_node.GetFirstNode();
 		ax::widget::Loader* loader = ax::widget::Loader::GetInstance();
 
+		// Callback stays on the shared Panel builder after this loader is gone, only capture the grid window.
 		auto panel_builder = loader->GetBuilder("Panel");
-		panel_builder->SetCreateCallback([&](ax::Window* win, ax::Xml::Node& node) {
+		panel_builder->SetCreateCallback([grid_win = _win](ax::Window* win, ax::Xml::Node& node) {
 			std::string builder_name = node.GetAttribute("builder");
 			std::string pyo_fct_name;
 
@@ -95,7 +97,9 @@ namespace editor {
 			std::vector<std::pair<std::string, std::string>> window_evts_fcts
 				= at::WindowEventsComponent::ParseValuesFromWidgetNode(node);
 
-			SetupExistingWidget(win, builder_name, pyo_fct_name, unique_name, "", window_evts_fcts);
+			Loader panel_loader(grid_win);
+			panel_loader.SetupExistingWidget(
+				win, builder_name, pyo_fct_name, unique_name, "", window_evts_fcts);
 		});
 
 		try {
@@ -427,6 +431,18 @@ namespace editor {
 		}));
 	}
 
+	// Save rects of widget and of its children (moved back on left or top resize) for undo.
+	void BeginWidgetRectEdit(ax::Window* win)
+	{
+		std::vector<ax::Window*> widgets(1, win);
+
+		for (auto& n : win->node.GetChildren()) {
+			widgets.push_back(n.get());
+		}
+
+		at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow()->GetJournal().BeginRectEdit(widgets);
+	}
+
 	void Loader::AssignOnMouseLeftDown(
 		ax::Window* gwin, ax::Window* win, std::function<void(ax::Point)> fct, const ax::Point& pos)
 	{
@@ -438,6 +454,7 @@ namespace editor {
 			win->resource.Add("click_delta", c_delta);
 			win->event.GrabMouse();
 			win->property.AddProperty("edit_click");
+			BeginWidgetRectEdit(win);
 
 			gwin->PushEvent(
 				at::editor::GridWindow::SELECT_WIDGET, new ax::event::SimpleMsg<ax::Window*>(win));
@@ -480,6 +497,7 @@ namespace editor {
 			win->resource.Add("click_delta", c_delta);
 			win->event.GrabMouse();
 			win->property.AddProperty("edit_click");
+			BeginWidgetRectEdit(win);
 			gwin->PushEvent(
 				at::editor::GridWindow::SELECT_WIDGET, new ax::event::SimpleMsg<ax::Window*>(win));
 		}
@@ -490,6 +508,30 @@ namespace editor {
 		}
 	}
 
+	// Children keep their position in grid window when left or top edge is moved.
+	void ResizeEditedWidget(ax::Window* gwin, ax::Window* win, const ax::Rect& rect)
+	{
+		const ax::Point delta(win->dimension.GetRect().position - rect.position);
+		win->dimension.SetRect(rect);
+
+		if (delta.x != 0 || delta.y != 0) {
+			std::vector<ax::Window*> children;
+
+			for (auto& n : win->node.GetChildren()) {
+				children.push_back(n.get());
+			}
+
+			GridWindow* grid = at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow();
+			GroupTransform transform(grid, children);
+			transform.Translate(delta);
+
+			// Recorded by BeginWidgetRectEdit.
+			transform.Commit(0);
+		}
+
+		gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
+	}
+
 	void Loader::AssignOnMouseLeftDragging(
 		ax::Window* gwin, ax::Window* win, std::function<void(ax::Point)> fct, const ax::Point& position)
 	{
@@ -509,128 +551,43 @@ namespace editor {
 
 				ax::Point c_delta = win->resource.GetResource("click_delta");
 
-				// Right resize.
-				if (win->property.HasProperty("ResizeRight")) {
-					int size_y = win->dimension.GetSize().h;
-					int size_x = pos.x - win->dimension.GetAbsoluteRect().position.x;
-					win->dimension.SetSize(ax::Size(size_x, size_y));
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				else if (win->property.HasProperty("ResizeBottomRight")) {
-					int size_y = pos.y - win->dimension.GetAbsoluteRect().position.y;
-					int size_x = pos.x - win->dimension.GetAbsoluteRect().position.x;
-					win->dimension.SetSize(ax::Size(size_x, size_y));
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				else if (win->property.HasProperty("ResizeTopRight")) {
-					ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
-					int size_x = pos.x - win->dimension.GetAbsoluteRect().position.x;
-					int size_y = abs_rect.position.y + abs_rect.size.h - pos.y;
-					int pos_y = pos.y - win->node.GetParent()->dimension.GetAbsoluteRect().position.y;
-					int pos_x = win->dimension.GetRect().position.x;
-					win->dimension.SetRect(ax::Rect(pos_x, pos_y, size_x, size_y));
-
-					ax::Point dd(0, abs_rect.position.y - pos.y);
-					std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
-					for (auto& n : children) {
-						ax::Point w_pos = n->dimension.GetRect().position;
-						n->dimension.SetPosition(w_pos + dd);
-					}
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				// Bottom resize.
-				else if (win->property.HasProperty("ResizeBottom")) {
-					int size_x = win->dimension.GetSize().w;
-					int size_y = pos.y - win->dimension.GetAbsoluteRect().position.y;
-					win->dimension.SetSize(ax::Size(size_x, size_y));
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				// Left resize.
-				else if (win->property.HasProperty("ResizeLeft")) {
-					ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
-					int size_x = abs_rect.position.x + abs_rect.size.w - pos.x;
-					int size_y = abs_rect.size.h;
-					int pos_y = win->dimension.GetRect().position.y;
-					int pos_x = pos.x - win->node.GetParent()->dimension.GetAbsoluteRect().position.x;
-					win->dimension.SetRect(ax::Rect(pos_x, pos_y, size_x, size_y));
-
-					ax::Point dd(abs_rect.position.x - pos.x, 0);
-					std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
-					for (auto& n : children) {
-						ax::Point w_pos = n->dimension.GetRect().position;
-						n->dimension.SetPosition(w_pos + dd);
-					}
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				else if (win->property.HasProperty("ResizeBottomLeft")) {
-					ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
-					int size_x = abs_rect.position.x + abs_rect.size.w - pos.x;
-					int size_y = pos.y - win->dimension.GetAbsoluteRect().position.y;
-					int pos_y = win->dimension.GetRect().position.y;
-					int pos_x = pos.x - win->node.GetParent()->dimension.GetAbsoluteRect().position.x;
-					win->dimension.SetRect(ax::Rect(pos_x, pos_y, size_x, size_y));
-
-					ax::Point dd(abs_rect.position.x - pos.x, 0);
-					std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
-					for (auto& n : children) {
-						ax::Point w_pos = n->dimension.GetRect().position;
-						n->dimension.SetPosition(w_pos + dd);
-					}
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				// Top resize.
-				else if (win->property.HasProperty("ResizeTop")) {
-					ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
-					int size_x = abs_rect.size.w;
-					int size_y = abs_rect.position.y + abs_rect.size.h - pos.y;
-					int pos_y = pos.y - win->node.GetParent()->dimension.GetAbsoluteRect().position.y;
-					int pos_x = win->dimension.GetRect().position.x;
-					win->dimension.SetRect(ax::Rect(pos_x, pos_y, size_x, size_y));
-
-					ax::Point dd(0, abs_rect.position.y - pos.y);
-					std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
-					for (auto& n : children) {
-						ax::Point w_pos = n->dimension.GetRect().position;
-						n->dimension.SetPosition(w_pos + dd);
-					}
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
-				}
-				else if (win->property.HasProperty("ResizeTopLeft")) {
-					ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
-					int size_x = abs_rect.position.x + abs_rect.size.w - pos.x;
-					int size_y = abs_rect.position.y + abs_rect.size.h - pos.y;
-					int pos_y = pos.y - win->node.GetParent()->dimension.GetAbsoluteRect().position.y;
-					int pos_x = pos.x - win->node.GetParent()->dimension.GetAbsoluteRect().position.x;
-					win->dimension.SetRect(ax::Rect(pos_x, pos_y, size_x, size_y));
-
-					ax::Point dd(abs_rect.position.x - pos.x, abs_rect.position.y - pos.y);
-					std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
-					for (auto& n : children) {
-						ax::Point w_pos = n->dimension.GetRect().position;
-						n->dimension.SetPosition(w_pos + dd);
-					}
-
-					gwin->PushEvent(at::editor::GridWindow::WIDGET_RESIZE, new ax::event::EmptyMsg());
+				auto has = [win](const char* p) { return win->property.HasProperty(p); };
+				const bool resize_left = has("ResizeLeft") || has("ResizeTopLeft") || has("ResizeBottomLeft");
+				const bool resize_right
+					= has("ResizeRight") || has("ResizeTopRight") || has("ResizeBottomRight");
+				const bool resize_top = has("ResizeTop") || has("ResizeTopLeft") || has("ResizeTopRight");
+				const bool resize_bottom
+					= has("ResizeBottom") || has("ResizeBottomLeft") || has("ResizeBottomRight");
+
+				// Resize.
+				if (resize_left || resize_right || resize_top || resize_bottom) {
+					const ax::Rect abs_rect(win->dimension.GetAbsoluteRect());
+					const ax::Rect parent_abs_rect(win->node.GetParent()->dimension.GetAbsoluteRect());
+					int left = resize_left ? pos.x : abs_rect.position.x;
+					int top = resize_top ? pos.y : abs_rect.position.y;
+					int right = resize_right ? pos.x : abs_rect.position.x + abs_rect.size.w;
+					int bottom = resize_bottom ? pos.y : abs_rect.position.y + abs_rect.size.h;
+
+					const ax::Point w_pos(ax::Point(left, top) - parent_abs_rect.position);
+					ResizeEditedWidget(gwin, win, ax::Rect(w_pos, ax::Size(right - left, bottom - top)));
 				}
 				// Moving widget.
 				else {
-					ax::Point w_position
-						= position - win->node.GetParent()->dimension.GetAbsoluteRect().position - c_delta;
+					const ax::Point gw_abs_pos(gwin->dimension.GetAbsoluteRect().position);
+					ax::Point gw_position = position - c_delta - gw_abs_pos;
 
 					if (gsp.IsSnapActive()) {
-						const ax::Point gw_abs_pos(gwin->dimension.GetAbsoluteRect().position);
-						w_position = gsp.FindClosestPosition(position - c_delta - gw_abs_pos) + gw_abs_pos
-							- win->node.GetParent()->dimension.GetAbsoluteRect().position;
+						gw_position = gsp.FindClosestPosition(gw_position);
+					}
+
+					if (gsp.IsSmartGuideActive()) {
+						gw_position
+							= gsp.FindGuidePosition(win, ax::Rect(gw_position, win->dimension.GetSize()));
 					}
 
-					win->dimension.SetPosition(w_position);
+					ax::Window* parent = win->node.GetParent();
+					const ax::Point parent_abs_pos(parent->dimension.GetAbsoluteRect().position);
+					win->dimension.SetPosition(gw_position + gw_abs_pos - parent_abs_pos);
 
 					if (!win->property.HasProperty("first_time_dragging")) {
 						win->property.AddProperty("first_time_dragging");
@@ -641,6 +598,8 @@ namespace editor {
 						gwin->PushEvent(at::editor::GridWindow::DRAGGING_WIDGET, new ax::event::EmptyMsg());
 					}
 				}
+
+				at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow()->UpdateWidgetIndex(win);
 			}
 		}
 
@@ -658,6 +617,7 @@ namespace editor {
 		// Editing.
 		if (win->property.HasProperty("edit_click")) {
 			win->property.RemoveProperty("edit_click");
+			at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow()->GetJournal().EndRectEdit();
 			win->property.RemoveProperty("ResizeLeft");
 			win->property.RemoveProperty("ResizeRight");
 			win->property.RemoveProperty("ResizeBottom");
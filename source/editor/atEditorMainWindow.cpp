@@ -38,10 +38,13 @@
 
 #include "PyoAudio.h"
 #include "atCommon.hpp"
+#include "atConsoleStream.h"
 #include "atHelpBar.h"
+#include "editor/atEditorGroupTransform.hpp"
 #include "editor/atEditorLoader.hpp"
 
 #include "dialog/atSaveWorkDialog.hpp"
+#include "project/atAssetStore.hpp"
 
 #include <time.h>
 
@@ -124,6 +127,11 @@ namespace editor {
 		_gridWindow->GetWindow()->AddConnection(
 			GridWindow::SNAP_WIDGET_TO_GRID_FROM_RIGHT_CLICK, GetOnSnapToGridWidgetFromRightClickMenu());
 
+		_gridWindow->GetWindow()->AddConnection(
+			GridWindow::ALIGN_WIDGETS_FROM_RIGHT_CLICK, GetOnAlignWidgetsFromRightClickMenu());
+
+		_gridWindow->GetWindow()->AddConnection(GridWindow::LAYOUT_UNDO_REDO, GetOnLayoutUndoRedo());
+
 		_gridWindow->GetWindow()->AddConnection(
 			GridWindow::SELECT_MULTIPLE_WIDGET, _widget_handler.GetOnSelectMultipleWidget());
 
@@ -341,15 +349,48 @@ namespace editor {
 			return;
 		}
 
-		for (auto& n : _selected_windows) {
-			ax::Window* wwin = n;
-			GridSnapProxy gsp = GetGridSnapProxy();
+		GroupTransform transform(_gridWindow.get(), _selected_windows);
+		transform.SnapToGrid();
+		transform.Commit();
+	}
+
+	void MainWindow::OnAlignWidgetsFromRightClickMenu(const ax::event::StringMsg& msg)
+	{
+		const std::string& choice = msg.GetMsg();
+		GroupTransform transform(_gridWindow.get(), _selected_windows);
 
-			const ax::Rect gw_abs_rect(_gridWindow->GetWindow()->dimension.GetAbsoluteRect());
-			ax::Point pos
-				= gsp.FindClosestPosition(wwin->dimension.GetAbsoluteRect().position - gw_abs_rect.position);
-			pos += gw_abs_rect.position;
-			wwin->dimension.SetPosition(pos - wwin->node.GetParent()->dimension.GetAbsoluteRect().position);
+		if (choice == "Align left") {
+			transform.Align(GroupTransform::Alignment::LEFT);
+		}
+		else if (choice == "Align right") {
+			transform.Align(GroupTransform::Alignment::RIGHT);
+		}
+		else if (choice == "Align top") {
+			transform.Align(GroupTransform::Alignment::TOP);
+		}
+		else if (choice == "Align bottom") {
+			transform.Align(GroupTransform::Alignment::BOTTOM);
+		}
+		else if (choice == "Distribute horizontally") {
+			transform.Distribute(GroupTransform::Distribution::HORIZONTAL);
+		}
+		else if (choice == "Distribute vertically") {
+			transform.Distribute(GroupTransform::Distribution::VERTICAL);
+		}
+
+		transform.Commit();
+	}
+
+	void MainWindow::OnLayoutUndoRedo(const ax::event::EmptyMsg& msg)
+	{
+		// MainWindow panel may have been removed or added back.
+		if (_gridWindow->GetMainWindow() == nullptr) {
+			_left_menu->SetOnlyMainWindowWidgetSelectable();
+			win->PushEvent(HAS_WIDGET_ON_GRID, new ax::event::SimpleMsg<bool>(false));
+		}
+		else {
+			_left_menu->SetAllSelectable();
+			win->PushEvent(HAS_WIDGET_ON_GRID, new ax::event::SimpleMsg<bool>(true));
 		}
 	}
 
@@ -367,6 +408,19 @@ namespace editor {
 		//----------------------------------------------------------------------
 		//		_codeEditor->SaveFile(_codeEditor->GetScriptPath());
 		_bottom_section->SaveFile(_bottom_section->GetScriptPath());
+
+		// Don't restart audio for a script that can't compile.
+		int err_line = -1;
+		std::string err_msg;
+
+		if (_bottom_section->HasScriptError(err_line, err_msg)) {
+			// Line is -1 when the error isn't tied to a line.
+			const std::string line_str = err_line < 0 ? "" : ", line " + std::to_string(err_line + 1);
+			at::ConsoleStream::GetInstance()->Error(
+				"Script not reloaded" + line_str + " : " + err_msg, LogStore::EDITOR);
+			return;
+		}
+
 		PyoAudio::GetInstance()->ReloadScript(_bottom_section->GetScriptPath());
 		//----------------------------------------------------------------------
 	}
@@ -419,10 +473,18 @@ namespace editor {
 		strftime(buffer, 80, "%Y_%m_%d_%H_%M_%S", timeinfo);
 		const std::string time_str(buffer, strlen(buffer));
 
-		const std::string img_path("custom_widgets_menu_images/" + time_str + ".png");
-		img.SaveImage(img_path);
+		// Menu images and widget files are stored once per content in the workspace.
+		at::AssetDirectory img_store("custom_widgets_menu_images/");
+		const std::string tmp_img_path("custom_widgets_menu_images/" + time_str + ".png");
+		img.SaveImage(tmp_img_path);
 		delete[] pdata;
 
+		std::string img_path = img_store.AddFile(time_str + ".png", tmp_img_path, true);
+
+		if (img_path.empty()) {
+			img_path = tmp_img_path;
+		}
+
 		// Callback for saving widget with child widgets in them.
 		std::function<void(ax::Xml&, ax::Xml::Node&, ax::Window*)> panel_save_child
 			= [&](ax::Xml& xml, ax::Xml::Node& node, ax::Window* child_win) {
@@ -459,7 +521,14 @@ namespace editor {
 
 		ax::Xml::Node wnode = wcomp->Save(xml, custom_widget_node);
 		wnode.RemoveChildNode("position");
-		xml.Save("custom_widgets/" + time_str + ".xml");
+
+		const std::string content = xml.GetString();
+		const std::vector<char> data(content.begin(), content.end());
+		at::AssetDirectory widget_store("custom_widgets/");
+
+		if (widget_store.AddContent(time_str + ".xml", data).empty()) {
+			xml.Save("custom_widgets/" + time_str + ".xml");
+		}
 	}
 
 	void MainWindow::OnPaint(ax::GC gc)
@@ -1,9 +1,14 @@
 #include "editor/atEditorProjectSpace.hpp"
+#include "atResourceCache.hpp"
 #include "atUniqueNameComponent.h"
 #include "editor/atEditor.hpp"
 #include "editor/atEditorGridWindow.hpp"
 #include "editor/atEditorMainWindow.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
 namespace at {
 namespace editor {
 	std::string GetWidgetName(ax::Window* w)
@@ -20,139 +25,104 @@ namespace editor {
 		return w_comp->GetBuilderName();
 	}
 
-	ProjectSpaceObj::ProjectSpaceObj(
-		const ax::Rect& rect, const std::string& name, ax::Window* widget, int level)
-		: _font(0)
-		, _font_bold("fonts/FreeSansBold.ttf")
-		, _name(name)
-		, _widget(widget)
-		, _level(level)
+	ProjectSpaceObj::ProjectSpaceObj(const ax::Rect& rect, ax::Font* font, ax::Font* font_bold)
+		: _font(font)
+		, _font_bold(font_bold)
 	{
 		// Create window.
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &ProjectSpaceObj::OnPaint);
 		win->event.OnMouseLeftDoubleClick
 			= ax::WBind<ax::Point>(this, &ProjectSpaceObj::OnMouseLeftDoubleClick);
+	}
 
-		if (widget == nullptr) {
+	void ProjectSpaceObj::SetRow(ProjectSpaceRow* row)
+	{
+		if (row == nullptr) {
+			_row = nullptr;
+			win->Hide();
 			return;
 		}
 
 		// Icon.
-		if (_name == "Panel") {
-			_icon_color = ax::Color(0.2);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon_panel.png");
-		}
-		else if (_name == "Button") {
-			_icon_color = ax::Color(200, 0, 0);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon.png");
-		}
-		else if (_name == "Knob") {
-			_icon_color = ax::Color(200, 200, 0);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon.png");
-		}
-		else if (_name == "Toggle") {
-			_icon_color = ax::Color(200, 0, 200);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon.png");
-		}
-		else if (_name == "Sprite") {
-			_icon_color = ax::Color(0, 200, 200);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon.png");
-		}
-		else {
-			_icon_color = ax::Color(0.7);
-			_icon = std::make_shared<ax::Image>("resources/tree_icon.png");
-		}
-
-		if (widget->component.Has("unique_name")) {
-			at::UniqueNameComponent::Ptr uname
-				= widget->component.Get<at::UniqueNameComponent>("unique_name");
-			_unique_name = uname->GetName();
-		}
-
-		// GetSelectedWindows
-
-		std::vector<std::shared_ptr<ax::Window>>& children = _widget->node.GetChildren();
+		if (_icon == nullptr || _icon_name != row->name) {
+			const std::string& name = row->name;
+			_icon_name = name;
 
-		ax::Point pos(0, rect.size.h);
-
-		for (auto w : children) {
-			const std::string w_name = GetWidgetName(w.get());
-			if (w_name.empty()) {
-				continue;
+			if (name == "Panel") {
+				_icon_color = ax::Color(0.2);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon_panel.png");
+			}
+			else if (name == "Button") {
+				_icon_color = ax::Color(200, 0, 0);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon.png");
+			}
+			else if (name == "Knob") {
+				_icon_color = ax::Color(200, 200, 0);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon.png");
+			}
+			else if (name == "Toggle") {
+				_icon_color = ax::Color(200, 0, 200);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon.png");
+			}
+			else if (name == "Sprite") {
+				_icon_color = ax::Color(0, 200, 200);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon.png");
+			}
+			else {
+				_icon_color = ax::Color(0.7);
+				_icon = ResourceCache::GetInstance()->GetImage("resources/tree_icon.png");
 			}
-
-			const ax::Size size(win->dimension.GetSize());
-			auto obj1 = std::make_shared<ProjectSpaceObj>(
-				ax::Rect(0, pos.y, size.w, 25), w_name, w.get(), _level + 1);
-			win->node.Add(obj1);
-			pos = obj1->GetWindow()->dimension.GetRect().GetNextPosDown(-1);
 		}
 
-		win->dimension.SetSize(ax::Size(rect.size.w, pos.y));
-	}
+		_row = row;
 
-	void ProjectSpaceObj::UnSelectAll()
-	{
-		if (_is_selected) {
-			_is_selected = false;
-			win->Update();
+		if (!win->IsShown()) {
+			win->Show();
 		}
 
-		for (auto n : win->node.GetChildren()) {
-			n->GetBackbone<ProjectSpaceObj>()->UnSelectAll();
-		}
+		win->Update();
 	}
 
-	void ProjectSpaceObj::SetSelectedWidgets(const std::vector<ax::Window*>& widgets)
+	void ProjectSpaceObj::OnMouseLeftDoubleClick(const ax::Point& pos)
 	{
-		if (_widget == nullptr) {
+		if (_row == nullptr) {
 			return;
 		}
 
-		for (ax::Window* w : widgets) {
-			if (_widget->GetId() == w->GetId()) {
-				_is_selected = true;
-				win->Update();
-				break;
-			}
-		}
-
-		for (auto n : win->node.GetChildren()) {
-			n->GetBackbone<ProjectSpaceObj>()->SetSelectedWidgets(widgets);
-		}
-	}
-
-	void ProjectSpaceObj::OnMouseLeftDoubleClick(const ax::Point& pos)
-	{
 		editor::App* app = editor::App::GetInstance();
 		editor::MainWindow* main_win = app->GetMainWindow();
 		editor::GridWindow* grid_win = main_win->GetGridWindow();
 		grid_win->GetWindow()->PushEvent(
-			at::editor::GridWindow::SELECT_WIDGET, new ax::event::SimpleMsg<ax::Window*>(_widget));
+			at::editor::GridWindow::SELECT_WIDGET, new ax::event::SimpleMsg<ax::Window*>(_row->widget));
 
-		_is_selected = true;
+		_row->is_selected = true;
 		win->Update();
 	}
 
 	void ProjectSpaceObj::OnPaint(ax::GC gc)
 	{
+		if (_row == nullptr) {
+			return;
+		}
+
 		const ax::Rect rect(win->dimension.GetDrawingRect());
+		const int level = _row->level;
 
-		_is_selected ? gc.SetColor(ax::Color(0.95)) : gc.SetColor(ax::Color(1.0));
+		_row->is_selected ? gc.SetColor(ax::Color(0.95)) : gc.SetColor(ax::Color(1.0));
 		gc.DrawRectangle(rect);
 
 		if (_icon->IsImageReady()) {
-			gc.DrawImageColor(_icon.get(), ax::Point(10 + _level * 15, 6), _icon_color);
+			gc.DrawImageColor(_icon.get(), ax::Point(10 + level * 15, 6), _icon_color);
 		}
 
-		_is_selected ? gc.SetColor(ax::Color(250, 172, 0)) : gc.SetColor(ax::Color(0.3));
-		gc.DrawString(_font_bold, _name, ax::Point(25 + _level * 15, 4));
+		_row->is_selected ? gc.SetColor(ax::Color(250, 172, 0)) : gc.SetColor(ax::Color(0.3));
+		gc.DrawString(*_font_bold, _row->name, ax::Point(25 + level * 15, 4));
 
-		if (!_unique_name.empty()) {
+		if (!_row->unique_name.empty()) {
 			gc.SetColor(ax::Color(0.3));
 			gc.DrawStringAlignedRight(
-				_font, _unique_name, ax::Rect(rect.position, rect.size - ax::Size(10, 0)));
+				*_font, _row->unique_name, ax::Rect(rect.position, rect.size - ax::Size(10, 0)));
 		}
 
 		gc.SetColor(ax::Color(0.7));
@@ -168,13 +138,17 @@ namespace editor {
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &ProjectSpace::OnPaint);
 		win->event.OnResize = ax::WBind<ax::Size>(this, &ProjectSpace::OnResize);
+		win->event.OnScrollWheel = ax::WBind<ax::Point>(this, &ProjectSpace::OnScrollWheel);
+		win->event.OnMouseEnter = ax::WBind<ax::Point>(this, &ProjectSpace::OnMouseEnter);
+		win->event.OnMouseEnterChild = ax::WBind<ax::Point>(this, &ProjectSpace::OnMouseEnterChild);
+		win->event.OnMouseLeave = ax::WBind<ax::Point>(this, &ProjectSpace::OnMouseLeave);
+		win->event.OnMouseLeaveChild = ax::WBind<ax::Point>(this, &ProjectSpace::OnMouseLeaveChild);
 
-		// Create scrolling window.
+		// Only shown rows have a window, scrollbar is used as a slider on the row index.
 		_panel = ax::Window::Create(ax::Rect(0, 0, rect.size.w, rect.size.h));
+		_panel->property.AddProperty("BlockDrawing");
 		win->node.Add(std::shared_ptr<ax::Window>(_panel));
 
-		ax::Point pos(0, 0);
-
 		ax::ScrollBar::Info sInfo;
 		sInfo.normal = ax::Color(0.80, 0.3);
 		sInfo.hover = ax::Color(0.85, 0.3);
@@ -184,16 +158,37 @@ namespace editor {
 		sInfo.bg_top = ax::Color(0.9, 0.2);
 		sInfo.bg_bottom = ax::Color(0.92, 0.2);
 
+		ax::ScrollBar::Events scroll_evts;
+		scroll_evts.value_change = GetOnScroll();
+
 		const ax::Rect sRect(rect.size.w - 9, 0, 10, rect.size.h);
-		auto sb = std::make_shared<ax::ScrollBar>(sRect, ax::ScrollBar::Events(), sInfo);
+		auto sb = std::make_shared<ax::ScrollBar>(sRect, scroll_evts, sInfo);
 		_scroll_bar = sb.get();
 		win->node.Add(sb);
 
-		_panel->property.AddProperty("BlockDrawing");
-		_panel->dimension.SetSizeNoShowRect(ax::Size(rect.size.w, rect.size.h));
+		_scroll_bar->UpdateWindowSize(rect.size);
+	}
+
+	void ProjectSpace::AddRows(ax::Window* widget, int level, std::vector<ProjectSpaceRow>& rows) const
+	{
+		ProjectSpaceRow row;
+		row.widget = widget;
+		row.level = level;
+		row.name = GetWidgetName(widget);
 
-		_scroll_bar->SetWindowHandle(_panel);
-		_scroll_bar->UpdateWindowSize(_panel->dimension.GetSize());
+		if (widget->component.Has("unique_name")) {
+			at::UniqueNameComponent::Ptr uname
+				= widget->component.Get<at::UniqueNameComponent>("unique_name");
+			row.unique_name = uname->GetName();
+		}
+
+		rows.push_back(row);
+
+		for (auto& n : widget->node.GetChildren()) {
+			if (!GetWidgetName(n.get()).empty()) {
+				AddRows(n.get(), level + 1, rows);
+			}
+		}
 	}
 
 	void ProjectSpace::UpdateTree()
@@ -211,49 +206,80 @@ namespace editor {
 				GridWindow::DELETE_SELECTED_WIDGET_FROM_RIGHT_CLICK, GetOnWidgetAddedOrRemoved());
 			gw->AddConnection(
 				GridWindow::DUPLICATE_SELECTED_WIDGET_FROM_RIGHT_CLICK, GetOnWidgetAddedOrRemoved());
+			gw->AddConnection(GridWindow::LAYOUT_UNDO_REDO, GetOnWidgetAddedOrRemoved());
 		}
 
-		// Remove all children.
-		_panel->node.GetChildren().clear();
-		_panel->Update();
-
 		editor::App* app = editor::App::GetInstance();
 		editor::MainWindow* main_win = app->GetMainWindow();
 		editor::GridWindow* grid_win = main_win->GetGridWindow();
 		ax::Window* main_widget = grid_win->GetMainWindow();
 
-		if (main_widget == nullptr) {
-			_has_objects = false;
-			win->Update();
-			return;
+		std::vector<ProjectSpaceRow> rows;
+
+		if (main_widget != nullptr) {
+			AddRows(main_widget, 0, rows);
 		}
 
-		const ax::Size size(win->dimension.GetSize());
-		auto obj1 = std::make_shared<ProjectSpaceObj>(
-			ax::Rect(0, 0, size.w, 25), GetWidgetName(main_widget), main_widget, 0);
-		_panel->node.Add(obj1);
+		// Rows are cheap to rebuild, only the shown rows have a window (see UpdateRowObjs).
+		_rows.swap(rows);
 
-		_panel->dimension.SetSizeNoShowRect(
-			ax::Size(size.w, obj1->GetWindow()->dimension.GetRect().GetNextPosDown(0).y)); // pos.y));
-		_scroll_bar->UpdateWindowSize(_panel->dimension.GetSize());
+		_has_objects = !_rows.empty();
 
+		UpdateScrollBar();
 		SetSelectedWidgets(editor::App::GetInstance()->GetMainWindow()->GetSelectedWindows());
-		_has_objects = true;
 		win->Update();
 	}
 
+	void ProjectSpace::UpdateScrollBar()
+	{
+		const ax::Size size(_panel->dimension.GetSize());
+		const int content_height = std::max(size.h, (int)_rows.size() * ROW_HEIGHT + 1);
+		_scroll_bar->UpdateWindowSize(ax::Size(size.w, content_height));
+
+		// Keep first shown row in range when tree got smaller.
+		const int n_shown = size.h / ROW_HEIGHT;
+		const int diff = std::max(0, (int)_rows.size() - n_shown);
+		_first_shown_row = std::min(_first_shown_row, diff);
+	}
+
+	void ProjectSpace::UpdateRowObjs()
+	{
+		const ax::Size size(_panel->dimension.GetSize());
+		const std::size_t n_objs = size.h / ROW_HEIGHT + 2;
+
+		while (_row_objs.size() < n_objs) {
+			auto obj = std::make_shared<ProjectSpaceObj>(
+				ax::Rect(0, (int)_row_objs.size() * ROW_HEIGHT, size.w, ROW_HEIGHT + 1), &_font, &_font_bold);
+			_panel->node.Add(obj);
+			_row_objs.push_back(obj.get());
+		}
+
+		for (std::size_t i = 0; i < _row_objs.size(); i++) {
+			const std::size_t index = _first_shown_row + i;
+			_row_objs[i]->SetRow(index < _rows.size() ? &_rows[index] : nullptr);
+		}
+	}
+
 	void ProjectSpace::UnSelectAll()
 	{
-		for (auto n : _panel->node.GetChildren()) {
-			n->GetBackbone<ProjectSpaceObj>()->UnSelectAll();
+		for (auto& n : _rows) {
+			n.is_selected = false;
 		}
+
+		UpdateRowObjs();
 	}
 
 	void ProjectSpace::SetSelectedWidgets(const std::vector<ax::Window*>& widgets)
 	{
-		for (auto n : _panel->node.GetChildren()) {
-			n->GetBackbone<ProjectSpaceObj>()->SetSelectedWidgets(widgets);
+		const std::unordered_set<ax::Window*> selected(widgets.begin(), widgets.end());
+
+		for (auto& n : _rows) {
+			if (selected.count(n.widget)) {
+				n.is_selected = true;
+			}
 		}
+
+		UpdateRowObjs();
 	}
 
 	void ProjectSpace::OnSelectWidget(const ax::event::SimpleMsg<ax::Window*>& msg)
@@ -298,12 +324,58 @@ namespace editor {
 		ax::console::Print("Builder name :", w_comp->GetBuilderName());
 	}
 
+	void ProjectSpace::OnScroll(const ax::ScrollBar::Msg& msg)
+	{
+		const int n_shown = _panel->dimension.GetSize().h / ROW_HEIGHT;
+		const int diff = std::max(0, (int)_rows.size() - n_shown);
+		_first_shown_row = (int)std::ceil(_scroll_bar->GetZeroToOneValue() * diff);
+		UpdateRowObjs();
+	}
+
+	void ProjectSpace::OnMouseEnter(const ax::Point& pos)
+	{
+		win->event.GrabScroll();
+	}
+
+	void ProjectSpace::OnMouseEnterChild(const ax::Point& pos)
+	{
+		win->event.GrabScroll();
+	}
+
+	void ProjectSpace::OnMouseLeave(const ax::Point& pos)
+	{
+		if (!win->dimension.GetAbsoluteRect().IsPointInside(pos)) {
+			win->event.UnGrabScroll();
+		}
+	}
+
+	void ProjectSpace::OnMouseLeaveChild(const ax::Point& pos)
+	{
+		if (!win->dimension.GetAbsoluteRect().IsPointInside(pos)) {
+			win->event.UnGrabScroll();
+		}
+	}
+
+	void ProjectSpace::OnScrollWheel(const ax::Point& delta)
+	{
+		double scroll_value
+			= (delta.y / (double)ax::App::GetInstance().GetFrameSize().h) + _scroll_bar->GetZeroToOneValue();
+
+		_scroll_bar->SetZeroToOneValue(ax::util::Clamp(scroll_value, 0.0, 1.0));
+	}
+
 	void ProjectSpace::OnResize(const ax::Size& size)
 	{
 		ax::Rect sRect(size.w - 9, 0, 10, size.h);
 		_scroll_bar->GetWindow()->dimension.SetRect(sRect);
-		_panel->dimension.SetShownRect(ax::Rect(0, 0, size.w, size.h));
-		_scroll_bar->UpdateWindowSize(_panel->dimension.GetSize());
+		_panel->dimension.SetSize(size);
+
+		for (auto& n : _row_objs) {
+			n->GetWindow()->dimension.SetSize(ax::Size(size.w, ROW_HEIGHT + 1));
+		}
+
+		UpdateScrollBar();
+		UpdateRowObjs();
 	}
 
 	void ProjectSpace::OnPaint(ax::GC gc)
@@ -13,6 +13,8 @@
 
 namespace at {
 namespace editor {
+	std::map<std::string, std::string> PyDoc::_class_briefs;
+
 	std::vector<std::pair<std::string, std::string>> GetClassNameBriefs(const std::vector<std::string>& names)
 	{
 		std::vector<std::pair<std::string, std::string>> elems;
@@ -20,12 +22,74 @@ namespace editor {
 
 		for (auto& n : names) {
 			elems.push_back(
-				std::pair<std::string, std::string>(n, PyoAudio::GetInstance()->GetClassBrief(n)));
+				std::pair<std::string, std::string>(n, PyDoc::GetClassBrief(n)));
 		}
 
 		return elems;
 	}
 
+	const PyDoc::ClassCategories& PyDoc::GetClassCategories()
+	{
+		static const ClassCategories categories = {
+			{ "Audio Signal Analysis",
+				{ "Follower", "Follower2", "ZCross", "Yin", "Centroid", "AttackDetector", "Spectrum", "Scope",
+					"PeakAmp" } },
+
+			{ "Arithmetic",
+				{ "Sin", "Cos", "Tan", "Tanh", "Abs", "Sqrt", "Log", "Log2", "Log10", "Atan2", "Floor",
+					"Ceil", "Round", "Pow" } },
+
+			{ "Control Signals", { "Fader", "Adsr", "Linseg", "Expseg", "Sig", "SigT" } },
+
+			{ "Dynamic management",
+				{ "Clip", "Degrade", "Mirror", "Compress", "Gate", "Balance", "Min", "Max", "Wrap" } },
+
+			{ "Special Effects",
+				{ "Disto", "Delay", "SDelay", "Delay1", "Waveguide", "AllpassWG", "Freeverb", "Convolve",
+					"WGVerb", "Chorus", "Harmonizer", "FreqShift", "STRev", "SmoothDelay" } },
+
+			{ "Filters",
+				{ "Biquad", "Biquadx", "Biquada", "EQ", "Tone", "Atone", "Port", "DCBlock", "BandSplit",
+					"FourBand", "Hilbert", "Allpass", "Allpass2", "Phaser", "Vocoder", "IRWinSinc",
+					"IRAverage", "IRPulse", "IRFM", "SVF", "Average", "Reson", "Resonx", "ButLP", "ButHP",
+					"ButBP", "ButBR", "ComplexRes" } },
+
+			{ "Fast Fourier Transform",
+				{ "FFT", "IFFT", "PolToCar", "CarToPol", "FrameAccum", "FrameDelta", "CvlVerb", "Vectral" } },
+
+			{ "Phase Vocoder",
+				{ "PVAnal", "PVSynth", "PVAddSynth", "PVTranspose", "PVVerb", "PVGate", "PVCross", "PVMult",
+					"PVMorph", "PVFilter", "PVDelay", "PVBuffer", "PVShift", "PVAmpMod", "PVFreqMod",
+					"PVBufLoops", "PVBufTabLoops", "PVMix" } },
+
+			{ "Signal Generators",
+				{ "Blit", "BrownNoise", "CrossFM", "FM", "Input", "LFO", "Lorenz", "Noise", "Phasor",
+					"PinkNoise", "RCOsc", "Rossler", "Sine", "SineLoop", "SumOsc", "SuperSaw" } },
+		};
+
+		return categories;
+	}
+
+	std::string PyDoc::GetClassBrief(const std::string& name)
+	{
+		auto it = _class_briefs.find(name);
+
+		if (it == _class_briefs.end()) {
+			it = _class_briefs.emplace(name, PyoAudio::GetInstance()->GetClassBrief(name)).first;
+		}
+
+		return it->second;
+	}
+
+	void PyDoc::LoadClassBriefs()
+	{
+		for (auto& category : GetClassCategories()) {
+			for (auto& n : category.second) {
+				GetClassBrief(n);
+			}
+		}
+	}
+
 	ax::Point PyDoc::AddSeparator(
 		const ax::Point& pos, const std::string& name, const std::vector<std::string>& args)
 	{
@@ -58,39 +122,9 @@ namespace editor {
 		ax::Point pos(0, 0);
 		ax::Size size(rect.size.w, 40);
 
-		pos = AddSeparator(
-			pos, "Audio Signal Analysis", { "Follower", "Follower2", "ZCross", "Yin", "Centroid",
-											  "AttackDetector", "Spectrum", "Scope", "PeakAmp" });
-
-		pos = AddSeparator(pos, "Arithmetic", { "Sin", "Cos", "Tan", "Tanh", "Abs", "Sqrt", "Log", "Log2",
-												  "Log10", "Atan2", "Floor", "Ceil", "Round", "Pow" });
-
-		pos = AddSeparator(pos, "Control Signals", { "Fader", "Adsr", "Linseg", "Expseg", "Sig", "SigT" });
-
-		pos = AddSeparator(pos, "Dynamic management",
-			{ "Clip", "Degrade", "Mirror", "Compress", "Gate", "Balance", "Min", "Max", "Wrap" });
-
-		pos = AddSeparator(pos, "Special Effects",
-			{ "Disto", "Delay", "SDelay", "Delay1", "Waveguide", "AllpassWG", "Freeverb", "Convolve",
-				"WGVerb", "Chorus", "Harmonizer", "FreqShift", "STRev", "SmoothDelay" });
-
-		pos = AddSeparator(
-			pos, "Filters", { "Biquad", "Biquadx", "Biquada", "EQ", "Tone", "Atone", "Port", "DCBlock",
-								"BandSplit", "FourBand", "Hilbert", "Allpass", "Allpass2", "Phaser",
-								"Vocoder", "IRWinSinc", "IRAverage", "IRPulse", "IRFM", "SVF", "Average",
-								"Reson", "Resonx", "ButLP", "ButHP", "ButBP", "ButBR", "ComplexRes" });
-
-		pos = AddSeparator(pos, "Fast Fourier Transform",
-			{ "FFT", "IFFT", "PolToCar", "CarToPol", "FrameAccum", "FrameDelta", "CvlVerb", "Vectral" });
-
-		pos = AddSeparator(pos, "Phase Vocoder",
-			{ "PVAnal", "PVSynth", "PVAddSynth", "PVTranspose", "PVVerb", "PVGate", "PVCross", "PVMult",
-				"PVMorph", "PVFilter", "PVDelay", "PVBuffer", "PVShift", "PVAmpMod", "PVFreqMod",
-				"PVBufLoops", "PVBufTabLoops", "PVMix" });
-
-		pos = AddSeparator(pos, "Signal Generators",
-			{ "Blit", "BrownNoise", "CrossFM", "FM", "Input", "LFO", "Lorenz", "Noise", "Phasor", "PinkNoise",
-				"RCOsc", "Rossler", "Sine", "SineLoop", "SumOsc", "SuperSaw" });
+		for (auto& n : GetClassCategories()) {
+			pos = AddSeparator(pos, n.first, n.second);
+		}
 
 		_scroll_panel->property.AddProperty("BlockDrawing");
 		_scroll_panel->dimension.SetSizeNoShowRect(ax::Size(rect.size.w, pos.y));
@@ -7,13 +7,14 @@
 //
 
 #include "editor/atEditorPyDocElement.hpp"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 
 namespace at {
 namespace editor {
 	PyDocElement::PyDocElement(const ax::Rect& rect, const std::string& name, const std::string& description)
-		: _font("fonts/Lato.ttf")
-		, _font_normal("fonts/LatoLight.ttf")
+		: _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
+		, _font_normal(ResourceCache::GetInstance()->GetFont("fonts/LatoLight.ttf"))
 		, _name(name)
 		, _description(description)
 	{
@@ -42,12 +43,12 @@ namespace editor {
 			at::Skin::GetInstance()->data.w_menu_obj_bg_1);
 
 		gc.SetColor(ax::Color(0.3));
-		gc.DrawString(_font, _name, ax::Point(5, 2));
+		gc.DrawString(*_font, _name, ax::Point(5, 2));
 
 		gc.SetColor(ax::Color(0.3));
 
 		for (int i = 0; i < _desc_content.size(); i++) {
-			gc.DrawString(_font_normal, _desc_content[i], ax::Point(5, 14 + i * 12));
+			gc.DrawString(*_font_normal, _desc_content[i], ax::Point(5, 14 + i * 12));
 		}
 
 		gc.SetColor(ax::Color(0.7));
@@ -7,6 +7,7 @@
 //
 
 #include "editor/atEditorPyDocSeparator.hpp"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 #include <axlib/Toggle.hpp>
 
@@ -14,7 +15,7 @@ namespace at {
 namespace editor {
 	PyDocSeparator::PyDocSeparator(const ax::Rect& rect, const std::string& name,
 		const std::vector<std::pair<std::string, std::string>>& elements)
-		: _font("fonts/FreeSansBold.ttf")
+		: _font(ResourceCache::GetInstance()->GetFont("fonts/FreeSansBold.ttf"))
 		, _name(name)
 	{
 		// Create window.
@@ -92,7 +93,7 @@ namespace editor {
 		gc.DrawRectangleContour(rect);
 
 		gc.SetColor(at::Skin::GetInstance()->data.w_menu_separator_text);
-		gc.DrawString(_font, _name, ax::Point(10, 2));
+		gc.DrawString(*_font, _name, ax::Point(10, 2));
 	}
 }
 }
@@ -122,7 +122,7 @@ namespace editor {
 		scroll_info.btn_info.contour = ax::Color(0.58);
 		scroll_info.btn_info.font_color = ax::Color(0.0, 0.0);
 
-		ax::Point pos(rect.size.w - 120 - 50, 2);
+		ax::Point pos(rect.size.w - 120 - 80, 2);
 
 		auto g_space_scroll = ax::shared<ax::NumberScroll>(
 			ax::Rect(pos + ax::Point(0, 4), ax::Size(45, 25 - 8)), GetOnGridSpace(), scroll_info, 10,
@@ -140,6 +140,14 @@ namespace editor {
 		AttachHelpInfo(_snap_btn->GetWindow(), "Activate / Deactivate snap to grid.");
 		pos = _snap_btn->GetWindow()->dimension.GetRect().GetNextPosRight(5);
 
+		// Smart guides button.
+		auto guide_btn
+			= ax::shared<ColorButton>(ax::Rect(pos, ax::Size(25, 25)), GetOnSmartGuide(), btn_info, "", "G");
+		_guide_btn = guide_btn.get();
+		win->node.Add(guide_btn);
+		AttachHelpInfo(_guide_btn->GetWindow(), "Activate / Deactivate alignment on other widgets.");
+		pos = _guide_btn->GetWindow()->dimension.GetRect().GetNextPosRight(5);
+
 		// Left panel toggle.
 		auto tog_left = ax::shared<ax::Toggle>(ax::Rect(pos, tog_size), GetOnToggleLeftPanel(), tog_info);
 		AttachHelpInfo(tog_left->GetWindow(), "Show / Hide widget menu.");
@@ -334,6 +342,15 @@ namespace editor {
 		}
 	}
 
+	void StatusBar::OnSmartGuide(const ax::Button::Msg& msg)
+	{
+		const bool active = !_guide_btn->IsSelected();
+		_guide_btn->SetSelected(active);
+
+		at::editor::GridSnapProxy gsp = at::editor::App::GetInstance()->GetMainWindow()->GetGridSnapProxy();
+		gsp.SetSmartGuide(active);
+	}
+
 	void StatusBar::OnToggleLeftPanel(const ax::Toggle::Msg& msg)
 	{
 		win->PushEvent(TOGGLE_LEFT_PANEL, new ax::Toggle::Msg(msg));
@@ -392,7 +409,7 @@ namespace editor {
 		//		_volumeMeterRight->GetWindow()->dimension.SetPosition(
 		//			_volumeMeterLeft->GetWindow()->dimension.GetRect().GetNextPosDown(0));
 
-		ax::Point pos(size.w - 120 - 50, 2);
+		ax::Point pos(size.w - 120 - 80, 2);
 
 		// Grid size number scroll.
 		_grid_space_scroll->GetWindow()->dimension.SetPosition(pos + ax::Point(0, 4));
@@ -402,6 +419,10 @@ namespace editor {
 		_snap_btn->GetWindow()->dimension.SetPosition(pos);
 		pos = _snap_btn->GetWindow()->dimension.GetRect().GetNextPosRight(5);
 
+		// Smart guides button.
+		_guide_btn->GetWindow()->dimension.SetPosition(pos);
+		pos = _guide_btn->GetWindow()->dimension.GetRect().GetNextPosRight(5);
+
 		// Left toggle.
 		_toggle_left->GetWindow()->dimension.SetPosition(pos);
 		pos = _toggle_left->GetWindow()->dimension.GetRect().GetNextPosRight(5);
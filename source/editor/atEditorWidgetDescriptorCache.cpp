@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/atEditorWidgetDescriptorCache.hpp"
+#include <axlib/Xml.hpp>
+#include <axlib/axlib.hpp>
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <fstream>
+
+namespace at {
+namespace editor {
+	namespace {
+		std::string Escape(const std::string& str)
+		{
+			std::string out;
+			out.reserve(str.size());
+
+			for (auto& c : str) {
+				if (c == '\\') {
+					out += "\\\\";
+				}
+				else if (c == '\t') {
+					out += "\\t";
+				}
+				else if (c == '\n') {
+					out += "\\n";
+				}
+				else {
+					out.push_back(c);
+				}
+			}
+
+			return out;
+		}
+
+		std::string Unescape(const std::string& str)
+		{
+			std::string out;
+			out.reserve(str.size());
+
+			for (std::size_t i = 0; i < str.size(); i++) {
+				if (str[i] == '\\' && i + 1 < str.size()) {
+					const char c = str[++i];
+					out.push_back(c == 't' ? '\t' : (c == 'n' ? '\n' : c));
+					continue;
+				}
+
+				out.push_back(str[i]);
+			}
+
+			return out;
+		}
+	}
+
+	std::unique_ptr<WidgetDescriptorCache> WidgetDescriptorCache::_instance = nullptr;
+
+	WidgetDescriptorCache* WidgetDescriptorCache::GetInstance()
+	{
+		if (_instance == nullptr) {
+			_instance.reset(new WidgetDescriptorCache());
+		}
+
+		return _instance.get();
+	}
+
+	WidgetDescriptorCache::WidgetDescriptorCache()
+		: _cache_path("widget_descriptors.cache")
+		, _modified(false)
+	{
+		Load();
+	}
+
+	bool WidgetDescriptorCache::GetDescriptor(const std::string& path, const std::string& node_name,
+		const std::vector<std::string>& attributes, Descriptor& descriptor)
+	{
+		boost::system::error_code err;
+		const std::time_t mtime = boost::filesystem::last_write_time(path, err);
+
+		if (err) {
+			return false;
+		}
+
+		auto it = _entries.find(path);
+		bool up_to_date
+			= it != _entries.end() && it->second.mtime == mtime && it->second.node_name == node_name;
+
+		// Attributes that weren't requested when the entry was cached.
+		if (up_to_date && it->second.valid) {
+			for (auto& n : attributes) {
+				if (it->second.values.find(n) == it->second.values.end()) {
+					up_to_date = false;
+					break;
+				}
+			}
+		}
+
+		if (!up_to_date) {
+			_entries[path] = ParseFile(path, mtime, node_name, attributes);
+			it = _entries.find(path);
+			_modified = true;
+		}
+
+		if (!it->second.valid) {
+			return false;
+		}
+
+		descriptor = it->second.values;
+		return true;
+	}
+
+	WidgetDescriptorCache::Entry WidgetDescriptorCache::ParseFile(const std::string& path, std::time_t mtime,
+		const std::string& node_name, const std::vector<std::string>& attributes)
+	{
+		Entry entry;
+		entry.mtime = mtime;
+		entry.node_name = node_name;
+		entry.valid = false;
+
+		try {
+			ax::Xml xml(path);
+
+			if (!xml.Parse()) {
+				ax::console::Error("Parsing widget :", path);
+				return entry;
+			}
+
+			ax::Xml::Node node = xml.GetNode(node_name);
+
+			if (!node.IsValid()) {
+				ax::console::Error("Parsing widget :", path, "can't find node", node_name);
+				return entry;
+			}
+
+			for (auto& n : attributes) {
+				entry.values[n] = node.GetAttribute(n);
+			}
+
+			entry.valid = true;
+		}
+		catch (ax::Xml::Exception& err) {
+			ax::console::Error("Widget menu xml", err.what());
+			entry.values.clear();
+		}
+
+		return entry;
+	}
+
+	bool WidgetDescriptorCache::Load()
+	{
+		std::ifstream file(_cache_path);
+
+		if (!file.is_open()) {
+			return false;
+		}
+
+		std::string line;
+
+		// One tab separated entry per line : path, mtime, node name, valid, then key and value pairs.
+		while (std::getline(file, line)) {
+			std::vector<std::string> values;
+			std::size_t begin = 0;
+
+			// Split by hand, getline drops an empty last field (e.g. empty last attribute value).
+			while (true) {
+				const std::size_t end = line.find('\t', begin);
+				values.push_back(Unescape(line.substr(begin, end - begin)));
+
+				if (end == std::string::npos) {
+					break;
+				}
+
+				begin = end + 1;
+			}
+
+			if (values.size() < 4 || (values.size() - 4) % 2) {
+				continue;
+			}
+
+			Entry entry;
+			entry.mtime = (std::time_t)std::strtoll(values[1].c_str(), nullptr, 10);
+			entry.node_name = values[2];
+			entry.valid = values[3] == "1";
+
+			for (std::size_t i = 4; i < values.size(); i += 2) {
+				entry.values[values[i]] = values[i + 1];
+			}
+
+			_entries[values[0]] = entry;
+		}
+
+		return true;
+	}
+
+	bool WidgetDescriptorCache::Save()
+	{
+		// Forget removed files so the cache doesn't grow forever.
+		for (auto it = _entries.begin(); it != _entries.end();) {
+			boost::system::error_code err;
+
+			if (!boost::filesystem::exists(it->first, err) && !err) {
+				it = _entries.erase(it);
+				_modified = true;
+			}
+			else {
+				++it;
+			}
+		}
+
+		if (!_modified) {
+			return true;
+		}
+
+		std::ofstream file(_cache_path, std::ios::trunc);
+
+		if (!file.is_open()) {
+			ax::console::Error("Can't save widget descriptor cache", _cache_path);
+			return false;
+		}
+
+		for (auto& n : _entries) {
+			const Entry& e = n.second;
+			file << Escape(n.first) << '\t' << (long long)e.mtime << '\t' << Escape(e.node_name) << '\t'
+				 << (e.valid ? "1" : "0");
+
+			for (auto& v : e.values) {
+				file << '\t' << Escape(v.first) << '\t' << Escape(v.second);
+			}
+
+			file << '\n';
+		}
+
+		_modified = !file.good();
+		return !_modified;
+	}
+}
+}
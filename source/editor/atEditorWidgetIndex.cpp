@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/atEditorWidgetIndex.hpp"
+
+#include <algorithm>
+
+namespace at {
+namespace editor {
+	WidgetIndex::WidgetIndex()
+	{
+		_root.depth = 0;
+	}
+
+	bool WidgetIndex::Intersects(const ax::Rect& a, const ax::Rect& b)
+	{
+		return a.position.x < b.position.x + b.size.w && b.position.x < a.position.x + a.size.w
+			&& a.position.y < b.position.y + b.size.h && b.position.y < a.position.y + a.size.h;
+	}
+
+	bool WidgetIndex::Contains(const ax::Rect& outer, const ax::Rect& inner)
+	{
+		return inner.position.x >= outer.position.x && inner.position.y >= outer.position.y
+			&& inner.position.x + inner.size.w <= outer.position.x + outer.size.w
+			&& inner.position.y + inner.size.h <= outer.position.y + outer.size.h;
+	}
+
+	void WidgetIndex::Clear(const ax::Rect& bounds)
+	{
+		_nodes.clear();
+		_root.items.clear();
+		_root.bounds = bounds;
+
+		for (auto& n : _root.children) {
+			n.reset();
+		}
+	}
+
+	void WidgetIndex::Insert(ax::Window* widget, const ax::Rect& rect)
+	{
+		Insert(&_root, Item{ widget, rect });
+	}
+
+	void WidgetIndex::Insert(Node* node, const Item& item)
+	{
+		while (node->children[0] != nullptr) {
+			Node* child = nullptr;
+
+			for (auto& n : node->children) {
+				if (Contains(n->bounds, item.rect)) {
+					child = n.get();
+					break;
+				}
+			}
+
+			// Straddling children.
+			if (child == nullptr) {
+				break;
+			}
+
+			node = child;
+		}
+
+		node->items.push_back(item);
+		_nodes[item.widget] = node;
+
+		if (node->children[0] == nullptr && node->items.size() > NODE_CAPACITY && node->depth < MAX_DEPTH) {
+			Split(node);
+		}
+	}
+
+	void WidgetIndex::Split(Node* node)
+	{
+		const ax::Rect& b = node->bounds;
+		const int half_w = b.size.w / 2;
+		const int half_h = b.size.h / 2;
+
+		if (half_w == 0 || half_h == 0) {
+			return;
+		}
+
+		const ax::Rect quads[4] = { ax::Rect(b.position.x, b.position.y, half_w, half_h),
+			ax::Rect(b.position.x + half_w, b.position.y, b.size.w - half_w, half_h),
+			ax::Rect(b.position.x, b.position.y + half_h, half_w, b.size.h - half_h),
+			ax::Rect(b.position.x + half_w, b.position.y + half_h, b.size.w - half_w, b.size.h - half_h) };
+
+		for (int i = 0; i < 4; i++) {
+			node->children[i].reset(new Node());
+			node->children[i]->bounds = quads[i];
+			node->children[i]->depth = node->depth + 1;
+		}
+
+		// Push down items fitting in a child.
+		std::vector<Item> items;
+		items.swap(node->items);
+
+		for (auto& n : items) {
+			Insert(node, n);
+		}
+	}
+
+	bool WidgetIndex::Remove(ax::Window* widget)
+	{
+		auto it = _nodes.find(widget);
+
+		if (it == _nodes.end()) {
+			return false;
+		}
+
+		std::vector<Item>& items = it->second->items;
+		auto item_it = std::find_if(
+			items.begin(), items.end(), [widget](const Item& item) { return item.widget == widget; });
+
+		if (item_it != items.end()) {
+			*item_it = items.back();
+			items.pop_back();
+		}
+
+		_nodes.erase(it);
+		return true;
+	}
+
+	void WidgetIndex::Update(ax::Window* widget, const ax::Rect& rect)
+	{
+		auto it = _nodes.find(widget);
+
+		// Rect still fits in the same leaf, only update the item.
+		if (it != _nodes.end() && it->second->children[0] == nullptr && Contains(it->second->bounds, rect)) {
+			for (auto& n : it->second->items) {
+				if (n.widget == widget) {
+					n.rect = rect;
+					return;
+				}
+			}
+		}
+
+		Remove(widget);
+		Insert(widget, rect);
+	}
+
+	bool WidgetIndex::GetRect(ax::Window* widget, ax::Rect& rect) const
+	{
+		auto it = _nodes.find(widget);
+
+		if (it == _nodes.end()) {
+			return false;
+		}
+
+		for (auto& n : it->second->items) {
+			if (n.widget == widget) {
+				rect = n.rect;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void WidgetIndex::GetWidgets(std::vector<ax::Window*>& widgets) const
+	{
+		widgets.reserve(widgets.size() + _nodes.size());
+
+		for (auto& n : _nodes) {
+			widgets.push_back(n.first);
+		}
+	}
+
+	void WidgetIndex::FindIntersecting(const ax::Rect& rect, std::vector<ax::Window*>& widgets) const
+	{
+		FindIntersecting(&_root, rect, widgets);
+	}
+
+	void WidgetIndex::FindIntersecting(
+		const Node* node, const ax::Rect& rect, std::vector<ax::Window*>& widgets) const
+	{
+		for (auto& n : node->items) {
+			if (Intersects(n.rect, rect)) {
+				widgets.push_back(n.widget);
+			}
+		}
+
+		if (node->children[0] == nullptr) {
+			return;
+		}
+
+		for (auto& n : node->children) {
+			if (Intersects(n->bounds, rect)) {
+				FindIntersecting(n.get(), rect, widgets);
+			}
+		}
+	}
+
+	void WidgetIndex::FindContaining(const ax::Point& pos, std::vector<ax::Window*>& widgets) const
+	{
+		FindIntersecting(&_root, ax::Rect(pos.x, pos.y, 1, 1), widgets);
+	}
+}
+}
@@ -24,12 +24,13 @@
 
 #include "editor/atEditorWidgetMenu.hpp"
 #include "atHelpBar.h"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 #include "editor/atEditor.hpp"
+#include "editor/atEditorWidgetDescriptorCache.hpp"
 
 #include <axlib/Button.hpp>
 #include <axlib/FileSystem.hpp>
-#include <axlib/Xml.hpp>
 
 #include <set>
 
@@ -57,6 +58,7 @@ namespace editor {
 		const ax::Size separator_size(rect.size.w, 20);
 
 		std::vector<WidgetMenuInfo> w_info = GetWidgetsInfo();
+		WidgetDescriptorCache::GetInstance()->Save();
 		std::string builder_name;
 
 		for (auto& n : w_info) {
@@ -99,6 +101,15 @@ namespace editor {
 		_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
 
 		SetOnlyMainWindowWidgetSelectable();
+
+		// Thumbnails are decoded when first drawn.
+		_image_listener_id = ResourceCache::GetInstance()->AddImageListener(
+			[this](const std::string& path) { _panel->Update(); });
+	}
+
+	WidgetMenu::~WidgetMenu()
+	{
+		ResourceCache::GetInstance()->RemoveImageListener(_image_listener_id);
 	}
 
 	std::vector<WidgetMenuInfo> WidgetMenu::GetWidgetsInfo()
@@ -120,38 +131,24 @@ namespace editor {
 				continue;
 			}
 
-			try {
-				const std::string file_path(n.GetAbsolutePath());
-				ax::Xml xml(file_path);
-
-				if (!xml.Parse()) {
-					ax::console::Error("Parsing widget :", n.GetName());
-					continue;
-				}
-
-				ax::Xml::Node node = xml.GetNode("Widget");
-
-				if (!node.IsValid()) {
-					ax::console::Error("Parsing widget :", n.GetName(), "can't find node Widget.");
-					continue;
-				}
-
-				WidgetMenuInfo info;
-				info.file_path = file_path;
-				info.buider_name = node.GetAttribute("builder");
-				info.widget_label = node.GetAttribute("label");
-				info.widget_desc = node.GetAttribute("description");
-				info.widget_size = node.GetAttribute("size");
-				info.widget_img = node.GetAttribute("img");
-				w_info.push_back(info);
-			}
-#warning("Catch this.")
-			//			catch (rapidxml::parse_error& err) {
-			//				ax::console::Error("Widget menu xml", err.what());
-			//			}
-			catch (ax::Xml::Exception& err) {
-				ax::console::Error("Widget menu xml", err.what());
+			const std::string file_path(n.GetAbsolutePath());
+			WidgetDescriptorCache::Descriptor desc;
+
+			// Only parsed when file changed since last run.
+			if (!WidgetDescriptorCache::GetInstance()->GetDescriptor(
+					file_path, "Widget", { "builder", "label", "description", "size", "img" }, desc)) {
+				ax::console::Error("Parsing widget :", n.GetName());
+				continue;
 			}
+
+			WidgetMenuInfo info;
+			info.file_path = file_path;
+			info.buider_name = desc["builder"];
+			info.widget_label = desc["label"];
+			info.widget_desc = desc["description"];
+			info.widget_size = desc["size"];
+			info.widget_img = desc["img"];
+			w_info.push_back(info);
 		}
 
 		std::sort(w_info.begin(), w_info.end(), [](WidgetMenuInfo& a, WidgetMenuInfo& b) {
@@ -7,6 +7,7 @@
 //
 
 #include "editor/atEditorWidgetMenuObj.hpp"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 #include "editor/GlobalEvents.hpp"
 #include "editor/atEditor.hpp"
@@ -14,15 +15,11 @@
 namespace at {
 namespace editor {
 	WidgetMenuObj::WidgetMenuObj(const ax::Rect& rect, const WidgetMenuInfo& info)
-		: _font("fonts/Lato.ttf")
-		, _font_normal("fonts/LatoLight.ttf")
+		: _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
+		, _font_normal(ResourceCache::GetInstance()->GetFont("fonts/LatoLight.ttf", 11))
 		, _info(info)
 		, _selectable(true)
 	{
-		_font_normal.SetFontSize(11);
-
-		_img = ax::shared<ax::Image>(_info.widget_img);
-
 		// Create window.
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &WidgetMenuObj::OnPaint);
@@ -90,17 +87,24 @@ namespace editor {
 		gc.DrawRectangleColorFade(rect, at::Skin::GetInstance()->data.w_menu_obj_bg_0,
 			at::Skin::GetInstance()->data.w_menu_obj_bg_1);
 
-		ax::Size img_size(_img->GetSize());
-		ax::Point img_pos(5 + (65 - img_size.w) / 2, 5 + (rect.size.h - 8 - img_size.h) / 2);
-		gc.DrawImage(_img.get(), img_pos);
+		// Image is loaded the first time it is shown.
+		if (_img == nullptr) {
+			_img = ResourceCache::GetInstance()->GetImageAsync(_info.widget_img);
+		}
+
+		if (_img != nullptr) {
+			ax::Size img_size(_img->GetSize());
+			ax::Point img_pos(5 + (65 - img_size.w) / 2, 5 + (rect.size.h - 8 - img_size.h) / 2);
+			gc.DrawImage(_img.get(), img_pos);
+		}
 
 		if (_show_text) {
 			gc.SetColor(at::Skin::GetInstance()->data.w_menu_title_txt);
-			gc.DrawString(_font, _info.widget_label, ax::Point(75, 6));
+			gc.DrawString(*_font, _info.widget_label, ax::Point(75, 6));
 
 			gc.SetColor(at::Skin::GetInstance()->data.w_menu_txt);
-			gc.DrawString(_font_normal, _info.widget_desc, ax::Point(75, 20));
-			gc.DrawString(_font_normal, _info.widget_size, ax::Point(75, 32));
+			gc.DrawString(*_font_normal, _info.widget_desc, ax::Point(75, 20));
+			gc.DrawString(*_font_normal, _info.widget_size, ax::Point(75, 32));
 		}
 
 		gc.SetColor(at::Skin::GetInstance()->data.w_menu_obj_contour);
@@ -7,12 +7,13 @@
 //
 
 #include "editor/atEditorWidgetMenuSeparator.hpp"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 
 namespace at {
 namespace editor {
 	WidgetMenuSeparator::WidgetMenuSeparator(const ax::Rect& rect, const std::string& name)
-		: _font("fonts/FreeSansBold.ttf")
+		: _font(ResourceCache::GetInstance()->GetFont("fonts/FreeSansBold.ttf"))
 		, _name(name)
 	{
 		// Create window.
@@ -47,7 +48,7 @@ namespace editor {
 		gc.DrawRectangleContour(rect);
 
 		gc.SetColor(at::Skin::GetInstance()->data.w_menu_separator_text);
-		gc.DrawString(_font, _name, ax::Point(10, 2));
+		gc.DrawString(*_font, _name, ax::Point(10, 2));
 	}
 }
 }
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "editor/atEditorWidgetPrototype.hpp"
+#include "atCommon.hpp"
+#include "atUniqueNameComponent.h"
+#include "atWindowEventsComponent.hpp"
+#include "editor/atEditor.hpp"
+#include "editor/atEditorGridWindow.hpp"
+#include "editor/atEditorLoader.hpp"
+#include "editor/atEditorMainWindow.hpp"
+#include "python/PyoComponent.hpp"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+
+namespace at {
+namespace editor {
+	std::map<std::string, WidgetPrototype::CacheEntry> WidgetPrototype::_custom_widgets;
+
+	bool HasSelectedAncestor(ax::Window* widget, const std::vector<ax::Window*>& widgets)
+	{
+		for (ax::Window* w = widget->node.GetParent(); w != nullptr; w = w->node.GetParent()) {
+			if (std::find(widgets.begin(), widgets.end(), w) != widgets.end()) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void CollectUniqueNames(ax::Window* window, std::set<std::string>& names)
+	{
+		if (window->component.Has(at::component::UNIQUE_NAME)) {
+			names.insert(
+				window->component.Get<at::UniqueNameComponent>(at::component::UNIQUE_NAME)->GetName());
+		}
+
+		for (auto& n : window->node.GetChildren()) {
+			CollectUniqueNames(n.get(), names);
+		}
+	}
+
+	/// Name with a new number at the end (e.g. step_3 -> step_4) that isn't in names.
+	std::string CreateUniqueName(const std::string& name, std::set<std::string>& names)
+	{
+		if (name.empty()) {
+			return name;
+		}
+
+		if (names.find(name) == names.end()) {
+			names.insert(name);
+			return name;
+		}
+
+		std::size_t num_pos = name.find_last_not_of("0123456789") + 1;
+
+		// Too long to be an index.
+		if (name.size() - num_pos > 9) {
+			num_pos = name.size();
+		}
+		const std::string base = name.substr(0, num_pos);
+		int index = num_pos < name.size() ? std::stoi(name.substr(num_pos)) : 0;
+		std::string unique_name;
+
+		do {
+			unique_name = base + std::to_string(++index);
+		} while (names.find(unique_name) != names.end());
+
+		names.insert(unique_name);
+		return unique_name;
+	}
+
+	WidgetPrototype::WidgetPrototype(const std::vector<ax::Window*>& widgets)
+	{
+		for (auto& n : widgets) {
+			if (!n->component.Has("Widget") || HasSelectedAncestor(n, widgets)) {
+				continue;
+			}
+
+			_roots.push_back(CreateNode(n));
+			_sources.push_back(n);
+		}
+	}
+
+	WidgetPrototype::Node WidgetPrototype::CreateNode(ax::Window* widget)
+	{
+		Node node;
+		node.backbone.reset(widget->backbone->GetCopy());
+		node.position = widget->dimension.GetRect().position;
+		node.builder_name = widget->component.Get<ax::widget::Component>("Widget")->GetBuilderName();
+
+		if (widget->component.Has("pyo")) {
+			node.pyo_fct = widget->component.Get<pyo::Component>("pyo")->GetFunctionName();
+		}
+
+		if (widget->component.Has(at::component::UNIQUE_NAME)) {
+			node.unique_name
+				= widget->component.Get<at::UniqueNameComponent>(at::component::UNIQUE_NAME)->GetName();
+		}
+
+		if (widget->component.Has(at::component::CLASS_NAME)) {
+			node.class_name
+				= widget->component.Get<at::UniqueNameComponent>(at::component::CLASS_NAME)->GetName();
+		}
+
+		if (widget->component.Has(at::component::WINDOW_EVENTS)) {
+			auto comp = widget->component.Get<at::WindowEventsComponent>(at::component::WINDOW_EVENTS);
+			node.window_events = comp->GetFunctionsValue();
+		}
+
+		for (auto& n : widget->node.GetChildren()) {
+			if (n->component.Has("Widget")) {
+				node.children.push_back(CreateNode(n.get()));
+			}
+		}
+
+		return node;
+	}
+
+	std::vector<std::shared_ptr<ax::Window::Backbone>> WidgetPrototype::Clone(bool setup_roots) const
+	{
+		GridWindow* grid = App::GetInstance()->GetMainWindow()->GetGridWindow();
+		Loader loader(grid->GetWindow());
+
+		// Names are gathered once for all clones.
+		std::set<std::string> names;
+		CollectUniqueNames(grid->GetWindow(), names);
+
+		std::vector<std::shared_ptr<ax::Window::Backbone>> clones;
+		clones.reserve(_roots.size());
+
+		for (auto& n : _roots) {
+			clones.push_back(CloneNode(n, loader, names, setup_roots));
+		}
+
+		return clones;
+	}
+
+	std::shared_ptr<ax::Window::Backbone> WidgetPrototype::CloneNode(
+		const Node& node, Loader& loader, std::set<std::string>& names, bool setup) const
+	{
+		std::shared_ptr<ax::Window::Backbone> bck_bone(node.backbone->GetCopy());
+
+		if (bck_bone == nullptr) {
+			return nullptr;
+		}
+
+		ax::Window* win = bck_bone->GetWindow();
+		win->dimension.SetPosition(node.position);
+
+		// Child widgets are copied from their own prototype node, other children (e.g. scroll bar)
+		// belong to the copy.
+		std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
+		auto is_widget = [](const std::shared_ptr<ax::Window>& c) { return c->component.Has("Widget"); };
+		children.erase(std::remove_if(children.begin(), children.end(), is_widget), children.end());
+
+		for (auto& n : node.children) {
+			std::shared_ptr<ax::Window::Backbone> child = CloneNode(n, loader, names, true);
+
+			if (child != nullptr) {
+				win->node.Add(child);
+			}
+		}
+
+		if (setup) {
+			loader.SetupExistingWidget(win, node.builder_name, node.pyo_fct,
+				CreateUniqueName(node.unique_name, names), node.class_name, node.window_events);
+			win->property.AddProperty("Selectable");
+		}
+
+		return bck_bone;
+	}
+
+	std::shared_ptr<WidgetPrototype> WidgetPrototype::GetCustomWidget(const std::string& path)
+	{
+		auto it = _custom_widgets.find(path);
+
+		if (it == _custom_widgets.end()) {
+			return nullptr;
+		}
+
+		boost::system::error_code ec;
+		const std::time_t mtime = boost::filesystem::last_write_time(path, ec);
+
+		// Custom widget was saved again.
+		if (ec || mtime != it->second.mtime) {
+			_custom_widgets.erase(it);
+			return nullptr;
+		}
+
+		return it->second.prototype;
+	}
+
+	void WidgetPrototype::AddCustomWidget(const std::string& path, std::shared_ptr<WidgetPrototype> prototype)
+	{
+		boost::system::error_code ec;
+		const std::time_t mtime = boost::filesystem::last_write_time(path, ec);
+
+		if (ec) {
+			return;
+		}
+
+		_custom_widgets[path] = CacheEntry{ mtime, prototype };
+	}
+}
+}
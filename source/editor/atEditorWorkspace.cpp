@@ -7,6 +7,8 @@
 //
 
 #include "editor/atEditorWorkspace.hpp"
+#include "atResourceCache.hpp"
+#include "editor/atEditorWidgetDescriptorCache.hpp"
 #include "editor/atEditorWorkspaceObj.hpp"
 #include <axlib/FileSystem.hpp>
 
@@ -43,50 +45,28 @@ namespace editor {
 				continue;
 			}
 
-			ax::console::Print(n.GetAbsolutePath());
+			WidgetDescriptorCache::Descriptor desc;
 
-			try {
-				ax::Xml xml(n.GetAbsolutePath());
-
-				if (!xml.Parse()) {
-					ax::console::Error("parsing workspace :", n.GetAbsolutePath());
-					continue;
-				}
-
-				//				ax::Xml::Node node = xml.GetNode("Widget");
-				ax::Xml::Node node = xml.GetNode("CustomWidget");
-
-				if (!node.IsValid()) {
-					ax::console::Error("No widget node in parsing workspace :", n.GetAbsolutePath());
-					continue;
-				}
+			if (!WidgetDescriptorCache::GetInstance()->GetDescriptor(n.GetAbsolutePath(), "CustomWidget",
+					{ "name", "description", "size", "img" }, desc)) {
+				ax::console::Error("parsing workspace :", n.GetAbsolutePath());
+				continue;
+			}
 
-				//				std::string buider_name = node.GetAttribute("builder");
-				//				std::string file_path = node.GetAttribute("file");
-				std::string buider_name = "none";
-				//				std::string file_path = "none";
+			std::string buider_name = "none";
+			auto obj = ax::shared<WorkspaceObj>(ax::Rect(pos, size), buider_name, n.GetAbsolutePath(),
+				desc["name"], desc["description"], desc["size"], desc["img"]);
+			win->node.Add(obj);
 
-				std::string widget_label = node.GetAttribute("name");
-				std::string widget_desc = node.GetAttribute("description");
-				std::string widget_size = node.GetAttribute("size");
-				std::string widget_img = node.GetAttribute("img");
+			_objs.push_back(obj);
 
-				auto obj = ax::shared<WorkspaceObj>(ax::Rect(pos, size), buider_name, n.GetAbsolutePath(),
-					widget_label, widget_desc, widget_size, widget_img);
-				win->node.Add(obj);
+			pos = obj->GetWindow()->dimension.GetRect().GetNextPosDown(0);
+		}
 
-				_objs.push_back(obj);
+		WidgetDescriptorCache::GetInstance()->Save();
 
-				pos = obj->GetWindow()->dimension.GetRect().GetNextPosDown(0);
-			}
-#warning("Catch this.")
-			//			catch (rapidxml::parse_error& err) {
-			//				ax::console::Error("Widget menu xml", err.what());
-			//			}
-			catch (ax::Xml::Exception& err) {
-				ax::console::Error("Widget menu xml", err.what());
-			}
-		}
+		_image_listener_id = ResourceCache::GetInstance()->AddImageListener(
+			[this](const std::string& path) { win->Update(); });
 
 		ax::ScrollBar::Info sInfo;
 		sInfo.normal = ax::Color(0.80, 0.3);
@@ -109,6 +89,11 @@ namespace editor {
 		_scrollBar->UpdateWindowSize(_panel->dimension.GetSize());
 	}
 
+	Workspace::~Workspace()
+	{
+		ResourceCache::GetInstance()->RemoveImageListener(_image_listener_id);
+	}
+
 	void Workspace::OnMouseEnter(const ax::Point& pos)
 	{
 		win->event.GrabScroll();
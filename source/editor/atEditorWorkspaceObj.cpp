@@ -7,6 +7,7 @@
 //
 
 #include "editor/atEditorWorkspaceObj.hpp"
+#include "atResourceCache.hpp"
 #include "atSkin.hpp"
 #include "editor/GlobalEvents.hpp"
 #include "editor/atEditor.hpp"
@@ -22,23 +23,16 @@ namespace editor {
 	WorkspaceObj::WorkspaceObj(const ax::Rect& rect, const std::string& builder_name,
 		const std::string& file_path, const std::string& title, const std::string& info,
 		const std::string& size, const std::string& img_path)
-		: _font("fonts/Lato.ttf")
-		, _font_normal("fonts/LatoLight.ttf")
+		: _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
+		, _font_normal(ResourceCache::GetInstance()->GetFont("fonts/LatoLight.ttf", 11))
 		, _builder_name(builder_name)
 		, _file_path(file_path)
 		, _title(title)
 		, _info(info)
 		, _size_str(size)
+		, _img_path(img_path)
 		, _selectable(true)
 	{
-		_font_normal.SetFontSize(11);
-
-		_img = ax::shared<ax::Image>(img_path);
-
-		if (_img->IsImageReady()) {
-			_img_size = CalculateAspectRatioFit(_img->GetSize(), ax::Size(45, 40));
-		}
-
 		// Create window.
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &WorkspaceObj::OnPaint);
@@ -106,19 +100,30 @@ namespace editor {
 		gc.DrawRectangleColorFade(rect, at::Skin::GetInstance()->data.w_menu_obj_bg_0,
 			at::Skin::GetInstance()->data.w_menu_obj_bg_1);
 
-		ax::Size img_size(_img_size);
-		ax::Point img_pos(5 + (65 - img_size.w) / 2, 5 + (rect.size.h - 8 - img_size.h) / 2);
-		gc.DrawImageResize(_img.get(), img_pos, img_size);
-		gc.SetColor(ax::Color(0.3));
-		gc.DrawRectangleContour(ax::Rect(img_pos, img_size));
+		// Image is loaded the first time it is shown.
+		if (_img == nullptr) {
+			_img = ResourceCache::GetInstance()->GetImageAsync(_img_path);
+
+			if (_img != nullptr && _img->IsImageReady()) {
+				_img_size = CalculateAspectRatioFit(_img->GetSize(), ax::Size(45, 40));
+			}
+		}
+
+		if (_img != nullptr) {
+			ax::Size img_size(_img_size);
+			ax::Point img_pos(5 + (65 - img_size.w) / 2, 5 + (rect.size.h - 8 - img_size.h) / 2);
+			gc.DrawImageResize(_img.get(), img_pos, img_size);
+			gc.SetColor(ax::Color(0.3));
+			gc.DrawRectangleContour(ax::Rect(img_pos, img_size));
+		}
 
 		if (_show_text) {
 			gc.SetColor(at::Skin::GetInstance()->data.w_menu_title_txt);
-			gc.DrawString(_font, _title, ax::Point(75, 6));
+			gc.DrawString(*_font, _title, ax::Point(75, 6));
 
 			gc.SetColor(at::Skin::GetInstance()->data.w_menu_txt);
-			gc.DrawString(_font_normal, _info, ax::Point(75, 20));
-			gc.DrawString(_font_normal, _size_str, ax::Point(75, 32));
+			gc.DrawString(*_font_normal, _info, ax::Point(75, 20));
+			gc.DrawString(*_font_normal, _size_str, ax::Point(75, 32));
 		}
 
 		gc.SetColor(at::Skin::GetInstance()->data.w_menu_obj_contour);
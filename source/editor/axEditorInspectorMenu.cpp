@@ -23,9 +23,12 @@
  */
 
 #include "atCommon.hpp"
+#include "atResourceCache.hpp"
 #include "atUniqueNameComponent.h"
 #include "atWindowEventsComponent.hpp"
+#include "editor/atEditor.hpp"
 #include "editor/atEditorInspectorMenu.hpp"
+#include "editor/atEditorMainWindow.hpp"
 #include "menu/attribute/atMenuAttribute.hpp"
 #include "menu/attribute/atMenuBoolAttribute.hpp"
 #include "menu/attribute/atMenuColorAttribute.hpp"
@@ -37,6 +40,7 @@
 #include "python/PyoComponent.hpp"
 
 #include <axlib/WindowManager.hpp>
+#include <algorithm>
 #include <fst/print.h>
 
 #include "editor/atEditor.hpp"
@@ -47,7 +51,7 @@ namespace at {
 namespace editor {
 	MenuSeparator::MenuSeparator(const ax::Rect& rect, const std::string& name)
 		: _name(name)
-		, _font("fonts/FreeSansBold.ttf")
+		, _font(ResourceCache::GetInstance()->GetFont("fonts/FreeSansBold.ttf"))
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &MenuSeparator::OnPaint);
@@ -61,7 +65,7 @@ namespace editor {
 		gc.DrawRectangle(rect);
 
 		gc.SetColor(ax::Color(0.3));
-		gc.DrawString(_font, _name, ax::Point(10, 2));
+		gc.DrawString(*_font, _name, ax::Point(10, 2));
 
 		gc.SetColor(ax::Color(0.94));
 		gc.DrawRectangleContour(rect);
@@ -79,13 +83,24 @@ namespace editor {
 					  ax::event::Function fct) { return std::make_shared<T>(rect, name, value, fct); });
 	}
 
+	// Get Attribute value setter function.
+	template <typename T>
+	inline std::pair<ax::widget::ParamType,
+		std::function<void(ax::Window::Backbone* att, const std::string& value)>>
+	CreateSetterPair(ax::widget::ParamType type)
+	{
+		return std::make_pair(type, [](ax::Window::Backbone* att, const std::string& value) {
+			static_cast<T*>(att)->SetValue(value);
+		});
+	}
+
 	/*
 	 * InspectorMenu.
 	 */
 	InspectorMenu::InspectorMenu(const ax::Rect& rect)
 		: _selected_handle(nullptr)
-		, _font("fonts/Lato.ttf")
-		, _font_bold("fonts/FreeSansBold.ttf")
+		, _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
+		, _font_bold(ResourceCache::GetInstance()->GetFont("fonts/FreeSansBold.ttf"))
 		, _has_multiple_widget_selected(false)
 	{
 		// Create window.
@@ -101,9 +116,65 @@ namespace editor {
 			_att_builder_map.insert(CreateBuilderPair<RangeAttribute>(ax::widget::ParamType::RANGE));
 			_att_builder_map.insert(CreateBuilderPair<IntegerAttribute>(ax::widget::ParamType::INTEGER));
 			_att_builder_map.insert(CreateBuilderPair<PathAttribute>(ax::widget::ParamType::FILEPATH));
+
+			// Editors that can be reused for another widget.
+			_att_setter_map.insert(CreateSetterPair<ColorAttribute>(ax::widget::ParamType::COLOR));
+			_att_setter_map.insert(CreateSetterPair<BoolAttribute>(ax::widget::ParamType::BOOLEAN));
+			_att_setter_map.insert(CreateSetterPair<PointAttribute>(ax::widget::ParamType::POINT));
+			_att_setter_map.insert(CreateSetterPair<SizeAttribute>(ax::widget::ParamType::SIZE));
+			_att_setter_map.insert(CreateSetterPair<RangeAttribute>(ax::widget::ParamType::RANGE));
+			_att_setter_map.insert(CreateSetterPair<IntegerAttribute>(ax::widget::ParamType::INTEGER));
 		}
 	}
 
+	ax::Window::Backbone* InspectorMenu::AddAttribute(ax::widget::ParamType type, const ax::Rect& rect,
+		const std::string& name, const std::string& value, bool is_info)
+	{
+		ax::event::Function fct = is_info ? GetOnInfoUpdate() : GetOnWidgetUpdate();
+		auto setter = _att_setter_map.find(type);
+
+		// Editor without value setter are rebuilt on each selection.
+		if (setter == _att_setter_map.end()) {
+			auto bb = _att_builder_map[type](rect, name, value, fct);
+			win->node.Add(bb);
+			return bb.get();
+		}
+
+		std::vector<PooledAttribute>& pool = _att_pool[type];
+
+		for (auto& n : pool) {
+			if (!n.is_used && n.is_info == is_info && n.name == name) {
+				n.is_used = true;
+				setter->second(n.att, value);
+				n.att->GetWindow()->dimension.SetPosition(rect.position);
+				n.att->GetWindow()->Show();
+				return n.att;
+			}
+		}
+
+		auto bb = _att_builder_map[type](rect, name, value, fct);
+		bb->GetWindow()->property.AddProperty("InspectorPool");
+		win->node.Add(bb);
+		pool.push_back(PooledAttribute{ name, is_info, bb.get(), true });
+		return bb.get();
+	}
+
+	void InspectorMenu::AddSeparator(const ax::Rect& rect, const std::string& name)
+	{
+		auto it = _separators.find(name);
+
+		if (it == _separators.end()) {
+			auto separator = ax::shared<MenuSeparator>(rect, name);
+			separator->GetWindow()->property.AddProperty("InspectorPool");
+			win->node.Add(separator);
+			_separators[name] = separator->GetWindow();
+			return;
+		}
+
+		it->second->dimension.SetPosition(rect.position);
+		it->second->Show();
+	}
+
 	void InspectorMenu::SetWidgetHandle(ax::Window* handle)
 	{
 		if (!_has_grid_window_connection) {
@@ -111,6 +182,7 @@ namespace editor {
 			ax::Window* gw = editor::App::GetInstance()->GetMainWindow()->GetGridWindow()->GetWindow();
 			gw->AddConnection(GridWindow::DRAGGING_WIDGET, GetOnDraggingWidget());
 			gw->AddConnection(GridWindow::WIDGET_RESIZE, GetOnWidgetResize());
+			gw->AddConnection(GridWindow::WIDGETS_TRANSFORMED, GetOnWidgetResize());
 			gw->AddConnection(GridWindow::ARROW_MOVE_SELECTED_WIDGET, GetOnArrowMoveSelectedWidget());
 		}
 
@@ -132,7 +204,7 @@ namespace editor {
 
 		ax::Point att_pos(0, 0);
 
-		win->node.Add(ax::shared<MenuSeparator>(ax::Rect(att_pos, separator_size), "Node"));
+		AddSeparator(ax::Rect(att_pos, separator_size), "Node");
 		att_pos.y += separator_size.h;
 
 		// Unique name attributes.
@@ -160,7 +232,7 @@ namespace editor {
 		}
 
 		// Add widget separator.
-		win->node.Add(ax::shared<MenuSeparator>(ax::Rect(att_pos, separator_size), "Widget"));
+		AddSeparator(ax::Rect(att_pos, separator_size), "Widget");
 		att_pos.y += separator_size.h;
 
 		ax::widget::Component::Ptr widget = _selected_handle->component.Get<ax::widget::Component>("Widget");
@@ -182,18 +254,16 @@ namespace editor {
 			fst::print("widget param type :", (int)n.first);
 			std::string value = atts_map[n.second];
 
-			auto it = _att_builder_map.find(n.first);
+			if (_att_builder_map.find(n.first) != _att_builder_map.end()) {
+				ax::Window::Backbone* bb
+					= AddAttribute(n.first, ax::Rect(att_pos, att_size), n.second, value, false);
 
-			if (it != _att_builder_map.end()) {
-				auto bb = it->second(ax::Rect(att_pos, att_size), n.second, value, GetOnWidgetUpdate());
 				if (n.second == "position") {
-					_widget_build_pos_att = bb.get();
+					_widget_build_pos_att = bb;
 				}
 				else if (n.second == "size") {
-					_widget_build_size_att = bb.get();
+					_widget_build_size_att = bb;
 				}
-
-				win->node.Add(bb);
 			}
 			else {
 				win->node.Add(ax::shared<at::inspector::MenuAttribute>(
@@ -203,7 +273,7 @@ namespace editor {
 			att_pos.y += att_size.h;
 		}
 
-		win->node.Add(ax::shared<MenuSeparator>(ax::Rect(att_pos, separator_size), "Info"));
+		AddSeparator(ax::Rect(att_pos, separator_size), "Info");
 
 		att_pos.y += separator_size.h;
 
@@ -214,10 +284,8 @@ namespace editor {
 		for (auto& n : info_atts) {
 			std::string value = info->GetAttributeValue(n.second);
 
-			auto it = _att_builder_map.find(n.first);
-
-			if (it != _att_builder_map.end()) {
-				win->node.Add(it->second(ax::Rect(att_pos, att_size), n.second, value, GetOnInfoUpdate()));
+			if (_att_builder_map.find(n.first) != _att_builder_map.end()) {
+				AddAttribute(n.first, ax::Rect(att_pos, att_size), n.second, value, true);
 			}
 			else {
 				win->node.Add(ax::shared<at::inspector::MenuAttribute>(
@@ -231,7 +299,7 @@ namespace editor {
 		if (_selected_handle->component.Has("pyo")) {
 			pyo::Component::Ptr pyo_comp = _selected_handle->component.Get<pyo::Component>("pyo");
 
-			win->node.Add(ax::shared<MenuSeparator>(ax::Rect(att_pos, separator_size), "Pyo"));
+			AddSeparator(ax::Rect(att_pos, separator_size), "Pyo");
 
 			att_pos.y += separator_size.h;
 
@@ -244,7 +312,7 @@ namespace editor {
 
 		// WindowEvents attributes.
 		if (_selected_handle->component.Has(at::component::WINDOW_EVENTS)) {
-			win->node.Add(ax::shared<MenuSeparator>(ax::Rect(att_pos, separator_size), "Window Events"));
+			AddSeparator(ax::Rect(att_pos, separator_size), "Window Events");
 			att_pos.y += separator_size.h;
 
 			auto comp
@@ -267,7 +335,23 @@ namespace editor {
 		ax::App::GetInstance().GetWindowManager()->UnGrabKey();
 
 		if (_selected_handle != nullptr) {
-			win->node.GetChildren().clear();
+			// Pooled editors are only hidden.
+			std::vector<std::shared_ptr<ax::Window>>& children = win->node.GetChildren();
+			children.erase(std::remove_if(children.begin(), children.end(),
+							   [](const std::shared_ptr<ax::Window>& w) {
+								   return !w->property.HasProperty("InspectorPool");
+							   }),
+				children.end());
+
+			for (auto& n : children) {
+				n->Hide();
+			}
+
+			for (auto& n : _att_pool) {
+				for (auto& att : n.second) {
+					att.is_used = false;
+				}
+			}
 		}
 		_selected_handle = nullptr;
 		_widget_build_pos_att = nullptr;
@@ -360,7 +444,23 @@ namespace editor {
 				= _selected_handle->component.Get<ax::widget::Component>("Widget");
 
 			// ax::console::Print("WidgetUpdate :", msg.GetMsg().first, msg.GetMsg().second);
+			std::string old_value;
+
+			for (auto& n : widget->GetBuilderAttributes()) {
+				if (n.first == msg.GetMsg().first) {
+					old_value = n.second;
+					break;
+				}
+			}
+
 			widget->SetBuilderAttributes(std::vector<std::pair<std::string, std::string>>{ msg.GetMsg() });
+
+			GridWindow* grid = at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow();
+			grid->GetJournal().RecordAttribute(_selected_handle, LayoutJournal::Edit::BUILDER_ATTRIBUTE,
+				msg.GetMsg().first, old_value, msg.GetMsg().second);
+
+			// Position or size may have changed.
+			grid->UpdateWidgetIndex(_selected_handle);
 		}
 	}
 
@@ -371,9 +471,14 @@ namespace editor {
 			return;
 		}
 		ax::widget::Component::Ptr widget = _selected_handle->component.Get<ax::widget::Component>("Widget");
+		const std::string old_value = widget->GetInfo()->GetAttributeValue(msg.GetMsg().first);
 
 		widget->SetInfo(std::vector<std::pair<std::string, std::string>>{ msg.GetMsg() });
 		widget->ReloadInfo();
+
+		at::editor::App::GetInstance()->GetMainWindow()->GetGridWindow()->GetJournal().RecordAttribute(
+			_selected_handle, LayoutJournal::Edit::INFO_ATTRIBUTE, msg.GetMsg().first, old_value,
+			msg.GetMsg().second);
 	}
 
 	void InspectorMenu::SetMultipleWidgetSelected(bool on)
@@ -389,82 +494,44 @@ namespace editor {
 		}
 	}
 
-	void InspectorMenu::OnDraggingWidget(const ax::event::EmptyMsg& msg)
+	void InspectorMenu::UpdateTransformAttributes()
 	{
 		if (_selected_handle == nullptr) {
 			return;
 		}
 
-		if (_widget_build_pos_att == nullptr) {
-			return;
-		}
-
 		if (!_selected_handle->component.Has("Widget")) {
 			return;
 		}
 
-		at::inspector::PointAttribute* p_att
-			= static_cast<at::inspector::PointAttribute*>(_widget_build_pos_att);
 		ax::widget::Component::Ptr widget = _selected_handle->component.Get<ax::widget::Component>("Widget");
 		const std::vector<std::pair<std::string, std::string>> atts = widget->GetBuilderAttributes();
 
+		// Values are updated in place.
 		for (auto& n : atts) {
-			if (n.first == "position") {
-				p_att->SetValue(n.second);
+			if (n.first == "position" && _widget_build_pos_att != nullptr) {
+				static_cast<at::inspector::PointAttribute*>(_widget_build_pos_att)->SetValue(n.second);
+			}
+			else if (n.first == "size" && _widget_build_size_att != nullptr) {
+				static_cast<at::inspector::SizeAttribute*>(_widget_build_size_att)->SetValue(n.second);
 			}
 		}
 	}
 
-	void InspectorMenu::OnWidgetResize(const ax::event::EmptyMsg& msg)
+	void InspectorMenu::OnDraggingWidget(const ax::event::EmptyMsg& msg)
 	{
-		if (_selected_handle == nullptr) {
-			return;
-		}
-
-		if (_widget_build_pos_att == nullptr) {
-			return;
-		}
-
-		if (!_selected_handle->component.Has("Widget")) {
-			return;
-		}
-
-		at::inspector::SizeAttribute* s_att
-			= static_cast<at::inspector::SizeAttribute*>(_widget_build_size_att);
-		ax::widget::Component::Ptr widget = _selected_handle->component.Get<ax::widget::Component>("Widget");
-		const std::vector<std::pair<std::string, std::string>> atts = widget->GetBuilderAttributes();
+		UpdateTransformAttributes();
+	}
 
-		for (auto& n : atts) {
-			if (n.first == "size") {
-				s_att->SetValue(n.second);
-			}
-		}
+	void InspectorMenu::OnWidgetResize(const ax::event::EmptyMsg& msg)
+	{
+		// Left and top resize also move the widget.
+		UpdateTransformAttributes();
 	}
 
 	void InspectorMenu::OnArrowMoveSelectedWidget(const ax::event::SimpleMsg<ax::util::Direction>& msg)
 	{
-		if (_selected_handle == nullptr) {
-			return;
-		}
-
-		if (_widget_build_pos_att == nullptr) {
-			return;
-		}
-
-		if (!_selected_handle->component.Has("Widget")) {
-			return;
-		}
-
-		at::inspector::PointAttribute* p_att
-			= static_cast<at::inspector::PointAttribute*>(_widget_build_pos_att);
-		ax::widget::Component::Ptr widget = _selected_handle->component.Get<ax::widget::Component>("Widget");
-		const std::vector<std::pair<std::string, std::string>> atts = widget->GetBuilderAttributes();
-
-		for (auto& n : atts) {
-			if (n.first == "position") {
-				p_att->SetValue(n.second);
-			}
-		}
+		UpdateTransformAttributes();
 	}
 
 	void InspectorMenu::OnPaint(ax::GC gc)
@@ -477,13 +544,13 @@ namespace editor {
 		gc.SetColor(ax::Color(0.3));
 
 		if (_has_multiple_widget_selected) {
-			gc.DrawString(_font_bold, "Multiple widgets selected.", ax::Point(15, 20));
+			gc.DrawString(*_font_bold, "Multiple widgets selected.", ax::Point(15, 20));
 		}
 		else {
 			// No widget selected mode.
-			gc.DrawString(_font_bold, "No widget selected.", ax::Point(15, 20));
-			gc.DrawString(_font, "Command + click over a widget on the", ax::Point(15, 40));
-			gc.DrawString(_font, "grid window to select a widget.", ax::Point(15, 52));
+			gc.DrawString(*_font_bold, "No widget selected.", ax::Point(15, 20));
+			gc.DrawString(*_font, "Command + click over a widget on the", ax::Point(15, 40));
+			gc.DrawString(*_font, "grid window to select a widget.", ax::Point(15, 52));
 		}
 
 		gc.SetColor(ax::Color(0.7));
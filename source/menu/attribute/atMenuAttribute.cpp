@@ -32,7 +32,6 @@ namespace inspector {
 		ax::event::Function fct, int label_font_size)
 		: _name(name)
 		, _value(value)
-		, _font("fonts/Lato.ttf")
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &MenuAttribute::OnPaint);
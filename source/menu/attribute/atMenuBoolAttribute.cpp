@@ -73,9 +73,15 @@ namespace inspector {
 		tog_info.single_img = false;
 
 		auto tog = ax::shared<ax::Toggle>(ax::Rect(95, 4, 13, 13), GetOnToggleClick(), tog_info);
+		_toggle = tog.get();
 		win->node.Add(tog);
 
-		tog->SetSelected((bool)std::stoi(value));
+		SetValue(value);
+	}
+
+	void BoolAttribute::SetValue(const std::string& value)
+	{
+		_toggle->SetSelected((bool)std::stoi(value));
 	}
 
 	void BoolAttribute::OnToggleClick(const ax::Toggle::Msg& msg)
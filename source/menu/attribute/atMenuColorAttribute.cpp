@@ -37,7 +37,6 @@ namespace inspector {
 		const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct)
 		: _name(name)
 		, _color(ax::Color::FromString(value))
-		, _font("fonts/Lato.ttf")
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &ColorAttribute::OnPaint);
@@ -59,6 +58,12 @@ namespace inspector {
 		win->node.Add(ax::shared<ax::Label>(ax::Rect(pos, ax::Size(90, 25)), labelInfo, _name));
 	}
 
+	void ColorAttribute::SetValue(const std::string& value)
+	{
+		_color = ax::Color::FromString(value);
+		win->Update();
+	}
+
 	void ColorAttribute::OnColorSelect(const ax::ColorPicker::Msg& msg)
 	{
 		win->PushEvent(
@@ -97,9 +97,15 @@ namespace inspector {
 			ax::Rect(ax::Point(90, 0), ax::Size(rect.size.w - 90, rect.size.h + 1)), GetOnValueChange(),
 			scroll_info, v, ax::util::Control::Type::INTEGER, ax::util::Range2D<double>(0.0, 10000.0), 1.0);
 
+		_scroll = w_scroll.get();
 		win->node.Add(w_scroll);
 	}
 
+	void IntegerAttribute::SetValue(const std::string& value)
+	{
+		_scroll->SetValue(value.empty() ? 0.0 : std::stod(value));
+	}
+
 	void IntegerAttribute::OnValueChange(const ax::NumberScroll::Msg& msg)
 	{
 		double v = msg.GetValue();
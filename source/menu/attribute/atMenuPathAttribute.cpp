@@ -17,7 +17,6 @@ namespace inspector {
 		const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct)
 		: _name(name)
 		, _value(value)
-		, _font("fonts/Lato.ttf")
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &PathAttribute::OnPaint);
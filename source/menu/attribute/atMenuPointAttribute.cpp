@@ -23,6 +23,7 @@
  */
 
 #include "menu/attribute/atMenuPointAttribute.hpp"
+#include "atResourceCache.hpp"
 #include <axlib/Button.hpp>
 #include <axlib/ColorPicker.hpp>
 #include <axlib/Label.hpp>
@@ -36,7 +37,7 @@ namespace inspector {
 	PointAttribute::PointAttribute(
 		const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct)
 		: _name(name)
-		, _font("fonts/Lato.ttf")
+		, _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &PointAttribute::OnPaint);
@@ -142,9 +143,9 @@ namespace inspector {
 		gc.DrawRectangle(rect);
 
 		gc.SetColor(ax::Color(0.0));
-		gc.DrawString(_font, "x :", ax::Point(93, 3));
+		gc.DrawString(*_font, "x :", ax::Point(93, 3));
 
-		gc.DrawString(_font, "y :", ax::Point(175, 3));
+		gc.DrawString(*_font, "y :", ax::Point(175, 3));
 
 		gc.SetColor(ax::Color(0.88));
 		gc.DrawRectangleContour(ax::Rect(rect.position, ax::Size(rect.size.w, rect.size.h + 1)));
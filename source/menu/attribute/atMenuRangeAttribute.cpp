@@ -23,6 +23,7 @@
  */
 
 #include "menu/attribute/atMenuRangeAttribute.hpp"
+#include "atResourceCache.hpp"
 #include <axlib/Button.hpp>
 #include <axlib/ColorPicker.hpp>
 #include <axlib/Label.hpp>
@@ -36,7 +37,7 @@ namespace inspector {
 	RangeAttribute::RangeAttribute(
 		const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct)
 		: _name(name)
-		, _font("fonts/Lato.ttf")
+		, _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &RangeAttribute::OnPaint);
@@ -107,6 +108,13 @@ namespace inspector {
 		win->node.Add(h_scroll);
 	}
 
+	void RangeAttribute::SetValue(const std::string& value)
+	{
+		auto range_values = ax::util::String::Split(value, ",");
+		_left_scroll->SetValue(std::stoi(range_values[0]));
+		_right_scroll->SetValue(std::stoi(range_values[1]));
+	}
+
 	void RangeAttribute::OnLeftChange(const ax::NumberScroll::Msg& msg)
 	{
 		std::string w_str = std::to_string((int)msg.GetValue());
@@ -135,9 +143,9 @@ namespace inspector {
 		gc.DrawRectangle(rect);
 
 		gc.SetColor(ax::Color(0.0));
-		gc.DrawString(_font, "l :", ax::Point(93, 3));
+		gc.DrawString(*_font, "l :", ax::Point(93, 3));
 
-		gc.DrawString(_font, "r :", ax::Point(175, 3));
+		gc.DrawString(*_font, "r :", ax::Point(175, 3));
 
 		gc.SetColor(ax::Color(0.88));
 		gc.DrawRectangleContour(ax::Rect(rect.position, ax::Size(rect.size.w, rect.size.h + 1)));
@@ -22,6 +22,7 @@
  * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
  */
 #include "menu/attribute/atMenuSizeAttribute.hpp"
+#include "atResourceCache.hpp"
 #include <axlib/Button.hpp>
 #include <axlib/ColorPicker.hpp>
 #include <axlib/Label.hpp>
@@ -35,7 +36,7 @@ namespace inspector {
 	SizeAttribute::SizeAttribute(
 		const ax::Rect& rect, const std::string& name, const std::string& value, ax::event::Function fct)
 		: _name(name)
-		, _font("fonts/Lato.ttf")
+		, _font(ResourceCache::GetInstance()->GetFont("fonts/Lato.ttf"))
 	{
 		win = ax::Window::Create(rect);
 		win->event.OnPaint = ax::WBind<ax::GC>(this, &SizeAttribute::OnPaint);
@@ -141,9 +142,9 @@ namespace inspector {
 		gc.DrawRectangle(rect);
 
 		gc.SetColor(ax::Color(0.0));
-		gc.DrawString(_font, "w :", ax::Point(93, 3));
+		gc.DrawString(*_font, "w :", ax::Point(93, 3));
 
-		gc.DrawString(_font, "h :", ax::Point(175, 3));
+		gc.DrawString(*_font, "h :", ax::Point(175, 3));
 
 		gc.SetColor(ax::Color(0.88));
 		gc.DrawRectangleContour(ax::Rect(rect.position, ax::Size(rect.size.w, rect.size.h + 1)));
@@ -164,6 +164,43 @@ bool FileArchive::AddDirectory(const std::string& name)
 	return true;
 }
 
+bool FileArchive::HasFile(const std::string& name)
+{
+	return zip_name_locate(_archive, name.c_str(), 0) >= 0;
+}
+
+bool FileArchive::RemoveFile(const std::string& name)
+{
+	zip_int64_t f_id = zip_name_locate(_archive, name.c_str(), 0);
+
+	if (f_id < 0) {
+		return false;
+	}
+
+	if (zip_delete(_archive, f_id) < 0) {
+		std::cout << "error removing file: " << zip_strerror(_archive) << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+std::vector<std::string> FileArchive::GetFileNames()
+{
+	std::vector<std::string> names;
+	zip_int64_t n_file = zip_get_num_entries(_archive, 0);
+
+	for (zip_int64_t i = 0; i < n_file; i++) {
+		const char* name = zip_get_name(_archive, i, 0);
+
+		if (name != nullptr) {
+			names.push_back(name);
+		}
+	}
+
+	return names;
+}
+
 bool FileArchive::ExtractArchive(const std::string& path)
 {
 	zip_int64_t n_file = zip_get_num_entries(_archive, 0);
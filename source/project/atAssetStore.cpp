@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "project/atAssetStore.hpp"
+#include <axlib/Util.hpp>
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <openssl/sha.h>
+#include <sstream>
+
+namespace at {
+const std::string AssetIndex::INDEX_NAME = "assets.index";
+const std::string AssetIndex::OBJECTS_FOLDER = "objects/";
+
+std::string AssetIndex::HashContent(const char* data, std::size_t size)
+{
+	// Collision resistant, different contents never end up sharing a blob.
+	unsigned char digest[SHA256_DIGEST_LENGTH];
+	SHA256((const unsigned char*)data, size, digest);
+
+	char buffer[2 * SHA256_DIGEST_LENGTH + 1];
+
+	for (int i = 0; i < SHA256_DIGEST_LENGTH; i++) {
+		std::snprintf(buffer + 2 * i, 3, "%02x", digest[i]);
+	}
+
+	return std::string(buffer, 2 * SHA256_DIGEST_LENGTH);
+}
+
+std::string AssetIndex::GetObjectName(const std::string& hash, const std::string& name)
+{
+	return hash + boost::filesystem::path(name).extension().string();
+}
+
+bool AssetIndex::HasName(const std::string& name) const
+{
+	return _entries.find(name) != _entries.end();
+}
+
+std::string AssetIndex::GetHash(const std::string& name) const
+{
+	auto it = _entries.find(name);
+
+	if (it == _entries.end()) {
+		return "";
+	}
+
+	return it->second;
+}
+
+void AssetIndex::SetName(const std::string& name, const std::string& hash)
+{
+	_entries[name] = hash;
+}
+
+void AssetIndex::RemoveName(const std::string& name)
+{
+	_entries.erase(name);
+}
+
+void AssetIndex::Clear()
+{
+	_entries.clear();
+}
+
+bool AssetIndex::IsReferenced(const std::string& hash) const
+{
+	for (auto& n : _entries) {
+		if (n.second == hash) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::string AssetIndex::Serialize() const
+{
+	std::string content;
+
+	for (auto& n : _entries) {
+		content += n.second + " " + n.first + "\n";
+	}
+
+	return content;
+}
+
+bool AssetIndex::Parse(const std::string& content)
+{
+	_entries.clear();
+
+	std::istringstream stream(content);
+	std::string line;
+
+	while (std::getline(stream, line)) {
+		if (line.empty()) {
+			continue;
+		}
+
+		const std::size_t space = line.find(' ');
+
+		if (space == std::string::npos || space == 0 || space + 1 == line.size()) {
+			ax::console::Error("Asset index invalid line :", line);
+			_entries.clear();
+			return false;
+		}
+
+		_entries[line.substr(space + 1)] = line.substr(0, space);
+	}
+
+	return true;
+}
+
+AssetDirectory::AssetDirectory(const std::string& dir_path)
+	: _dir_path(dir_path)
+{
+	if (!_dir_path.empty() && _dir_path.back() != '/') {
+		_dir_path.push_back('/');
+	}
+
+	std::ifstream file(_dir_path + AssetIndex::INDEX_NAME, std::ios::binary);
+
+	if (!file.is_open()) {
+		return;
+	}
+
+	const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	_index.Parse(content);
+}
+
+std::string AssetDirectory::AddContent(const std::string& name, const std::vector<char>& data)
+{
+	const std::string hash = AssetIndex::HashContent(data.data(), data.size());
+	const std::string path = _dir_path + AssetIndex::GetObjectName(hash, name);
+
+	// Only write content that isn't already in the store.
+	if (!boost::filesystem::exists(path)) {
+		std::ofstream file(path, std::ios::binary);
+
+		if (!file.is_open()) {
+			ax::console::Error("Can't write asset :", path);
+			return "";
+		}
+
+		file.write(data.data(), data.size());
+	}
+
+	_index.SetName(name, hash);
+
+	if (!SaveIndex()) {
+		ax::console::Error("Can't save asset index :", _dir_path + AssetIndex::INDEX_NAME);
+	}
+
+	return path;
+}
+
+std::string AssetDirectory::AddFile(const std::string& name, const std::string& file_path, bool remove_source)
+{
+	std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+
+	if (!file.is_open()) {
+		ax::console::Error("Can't open asset :", file_path);
+		return "";
+	}
+
+	std::vector<char> data((std::size_t)file.tellg());
+	file.seekg(0, std::ios::beg);
+	file.read(data.data(), data.size());
+	file.close();
+
+	const std::string path = AddContent(name, data);
+
+	if (remove_source && !path.empty() && path != file_path) {
+		boost::filesystem::remove(file_path);
+	}
+
+	return path;
+}
+
+std::string AssetDirectory::GetPath(const std::string& name) const
+{
+	const std::string hash = _index.GetHash(name);
+
+	if (hash.empty()) {
+		return "";
+	}
+
+	return _dir_path + AssetIndex::GetObjectName(hash, name);
+}
+
+bool AssetDirectory::SaveIndex() const
+{
+	std::ofstream file(_dir_path + AssetIndex::INDEX_NAME, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open()) {
+		return false;
+	}
+
+	file << _index.Serialize();
+	return file.good();
+}
+}
@@ -26,6 +26,7 @@
 #include <axlib/FileSystem.hpp>
 #include <axlib/Util.hpp>
 #include <boost/filesystem.hpp>
+#include <fstream>
 
 namespace at {
 ProjectFile::ProjectFile(const std::string& filename)
@@ -50,37 +51,64 @@ ProjectFile::ProjectFile(const std::string& filename)
 
 	if (_archive.Open(filename)) {
 		_is_valid = true;
+		LoadAssetIndex();
 	}
 }
 
-std::string ProjectFile::GetLayoutContent()
+void ProjectFile::LoadAssetIndex()
+{
+	_assets.Clear();
+
+	const std::string index_name(_project_name + "/" + AssetIndex::INDEX_NAME);
+
+	// Projects saved before the asset index have their files stored by name.
+	if (!_archive.HasFile(index_name)) {
+		return;
+	}
+
+	std::vector<char> data = _archive.GetFileContent(index_name);
+
+	if (!_assets.Parse(std::string(data.data(), data.size()))) {
+		ax::console::Error("Project asset index not valid.");
+	}
+}
+
+std::vector<char> ProjectFile::GetFileContent(const std::string& name)
 {
 	if (!_is_valid) {
-		return "";
+		return std::vector<char>();
 	}
 
-	std::vector<char> data = _archive.GetFileContent(_project_name + "/layout.xml");
+	const std::string hash = _assets.GetHash(name);
 
-	if (data.empty()) {
-		return "";
+	if (hash.empty()) {
+		return _archive.GetFileContent(_project_name + "/" + name);
 	}
 
-	return std::string(data.data());
+	return _archive.GetFileContent(
+		_project_name + "/" + AssetIndex::OBJECTS_FOLDER + AssetIndex::GetObjectName(hash, name));
 }
 
-std::string ProjectFile::GetScriptContent()
+std::string ProjectFile::GetLayoutContent()
 {
-	if (!_is_valid) {
+	std::vector<char> data = GetFileContent("layout.xml");
+
+	if (data.empty()) {
 		return "";
 	}
 
-	std::vector<char> data = _archive.GetFileContent(_project_name + "/script.py");
+	return std::string(data.data(), data.size());
+}
+
+std::string ProjectFile::GetScriptContent()
+{
+	std::vector<char> data = GetFileContent("script.py");
 
 	if (data.empty()) {
 		return "";
 	}
 
-	return std::string(data.data());
+	return std::string(data.data(), data.size());
 }
 
 ProjectFile::ProjectError ProjectFile::CreateTempFolder(const std::string& folder_path)
@@ -111,95 +139,137 @@ ProjectFile::ProjectError ProjectFile::CreateTempFolder(const std::string& folde
 
 bool ProjectFile::ExtractArchive(const std::string& path)
 {
-	return _archive.ExtractArchive(path);
-}
-
-bool ProjectFile::SaveProject()
-{
-	boost::filesystem::path tmp_dir(_tmp_folder_path);
+	if (_assets.IsEmpty()) {
+		return _archive.ExtractArchive(path);
+	}
 
-	if (boost::filesystem::is_directory(tmp_dir)) {
-		std::cout << tmp_dir << " is a directory containing:\n";
+	for (auto& n : _assets.GetEntries()) {
+		const std::string obj_name(
+			_project_name + "/" + AssetIndex::OBJECTS_FOLDER + AssetIndex::GetObjectName(n.second, n.first));
 
-		boost::filesystem::recursive_directory_iterator end;
+		// A missing object would otherwise be extracted as an empty file.
+		if (!_archive.HasFile(obj_name)) {
+			ax::console::Error("Project asset", n.first, "is missing from archive.");
+			return false;
+		}
 
-		std::vector<std::string> proj_files;
+		std::vector<char> f_content = _archive.GetFileContent(obj_name);
+		const std::string f_path(path + _project_name + "/" + n.first);
+		std::ofstream f_stream(f_path, std::ios::out | std::ios::binary);
 
-		for (boost::filesystem::recursive_directory_iterator i(tmp_dir); i != end; ++i) {
-			const boost::filesystem::path cp = (*i);
-			ax::console::Print(cp.filename().string());
-			proj_files.push_back(cp.filename().string());
+		if (!f_stream.is_open()) {
+			ax::console::Error("Can't create file", f_path);
+			return false;
 		}
 
-		std::vector<std::pair<std::string, std::vector<char>>> data;
+		f_stream.write(f_content.data(), f_content.size());
+		f_stream.close();
 
-		for (auto& n : proj_files) {
-			std::ifstream f_path(_tmp_folder_path + "/" + n, std::ios::binary | std::ios::ate);
-			std::ifstream::pos_type pos = f_path.tellg();
+		if (f_stream.fail()) {
+			ax::console::Error("Can't write file", f_path);
+			return false;
+		}
+	}
 
-			std::vector<char> buffer(pos);
+	return true;
+}
 
-			f_path.seekg(0, std::ios::beg);
-			f_path.read(&buffer[0], pos);
+bool ProjectFile::SaveTempFolderToArchive(at::FileArchive& archive, const std::string& name)
+{
+	boost::filesystem::path tmp_dir(_tmp_folder_path);
 
-			data.push_back(std::pair<std::string, std::vector<char>>(_project_name + "/" + n, buffer));
-		}
+	if (!boost::filesystem::is_directory(tmp_dir)) {
+		archive.Close();
+		return false;
+	}
 
-		for (auto& n : data) {
-			_archive.AddFileContent(n.first, (void*)n.second.data(), (unsigned int)n.second.size());
-		}
+	boost::filesystem::recursive_directory_iterator end;
+	std::vector<std::string> proj_files;
 
-		_archive.Close();
-		_archive.Open(_project_file_path);
+	for (boost::filesystem::recursive_directory_iterator i(tmp_dir); i != end; ++i) {
+		const boost::filesystem::path cp = (*i);
+		ax::console::Print(cp.filename().string());
+		proj_files.push_back(cp.filename().string());
 	}
 
-	return false;
-}
+	// Buffers have to stay alive until the archive is closed.
+	std::vector<std::vector<char>> data;
+	data.reserve(proj_files.size() + 1);
 
-bool ProjectFile::SaveAsProject(const std::string& filepath)
-{
-	boost::filesystem::path tmp_dir(_tmp_folder_path);
+	AssetIndex assets;
+	const std::string objects_folder(name + "/" + AssetIndex::OBJECTS_FOLDER);
 
-	if (boost::filesystem::is_directory(tmp_dir)) {
-		std::cout << tmp_dir << " is a directory containing:\n";
+	for (auto& n : proj_files) {
+		std::ifstream f_path(_tmp_folder_path + "/" + n, std::ios::binary | std::ios::ate);
+		std::ifstream::pos_type pos = f_path.tellg();
 
-		boost::filesystem::recursive_directory_iterator end;
+		std::vector<char> buffer(pos);
 
-		std::vector<std::string> proj_files;
+		f_path.seekg(0, std::ios::beg);
+		f_path.read(buffer.data(), pos);
 
-		for (boost::filesystem::recursive_directory_iterator i(tmp_dir); i != end; ++i) {
-			const boost::filesystem::path cp = (*i);
-			ax::console::Print(cp.filename().string());
-			proj_files.push_back(cp.filename().string());
+		const std::string hash = AssetIndex::HashContent(buffer.data(), buffer.size());
+		const std::string obj_name(objects_folder + AssetIndex::GetObjectName(hash, n));
+		assets.SetName(n, hash);
+
+		// Same content is only stored once.
+		if (archive.HasFile(obj_name)) {
+			continue;
 		}
 
-		std::vector<std::pair<std::string, std::vector<char>>> data;
+		data.push_back(std::move(buffer));
+		archive.AddFileContent(obj_name, (void*)data.back().data(), (unsigned int)data.back().size());
+	}
 
-		at::FileArchive arch_file;
-		arch_file.Open(filepath + ".atproj");
+	// Remove files stored by name (older projects) and blobs no longer referenced.
+	for (auto& f_name : archive.GetFileNames()) {
+		if (f_name.compare(0, objects_folder.size(), objects_folder) == 0) {
+			const boost::filesystem::path obj_path(f_name.substr(objects_folder.size()));
 
-		boost::filesystem::path f_path(filepath);
-		std::string name = f_path.filename().string();
-		arch_file.AddDirectory(name);
+			if (!obj_path.empty() && !assets.IsReferenced(obj_path.stem().string())) {
+				archive.RemoveFile(f_name);
+			}
+		}
+		else if (f_name.compare(0, name.size() + 1, name + "/") == 0 && f_name.size() > name.size() + 1
+			&& f_name.back() != '/' && assets.HasName(f_name.substr(name.size() + 1))) {
+			archive.RemoveFile(f_name);
+		}
+	}
 
-		for (auto& n : proj_files) {
-			std::ifstream f_path(_tmp_folder_path + "/" + n, std::ios::binary | std::ios::ate);
-			std::ifstream::pos_type pos = f_path.tellg();
+	const std::string index_content = assets.Serialize();
+	data.push_back(std::vector<char>(index_content.begin(), index_content.end()));
+	archive.AddFileContent(
+		name + "/" + AssetIndex::INDEX_NAME, (void*)data.back().data(), (unsigned int)data.back().size());
 
-			std::vector<char> buffer(pos);
+	archive.Close();
+	return true;
+}
 
-			f_path.seekg(0, std::ios::beg);
-			f_path.read(&buffer[0], pos);
+bool ProjectFile::SaveProject()
+{
+	if (!SaveTempFolderToArchive(_archive, _project_name)) {
+		_archive.Open(_project_file_path);
+		return false;
+	}
 
-			data.push_back(std::pair<std::string, std::vector<char>>(name + "/" + n, buffer));
-		}
+	_archive.Open(_project_file_path);
+	LoadAssetIndex();
+	return true;
+}
 
-		for (auto& n : data) {
-			arch_file.AddFileContent(n.first, (void*)n.second.data(), (unsigned int)n.second.size());
-		}
+bool ProjectFile::SaveAsProject(const std::string& filepath)
+{
+	at::FileArchive arch_file;
+
+	if (!arch_file.Open(filepath + ".atproj")) {
+		return false;
 	}
 
-	return false;
+	boost::filesystem::path f_path(filepath);
+	std::string name = f_path.filename().string();
+	arch_file.AddDirectory(name);
+
+	return SaveTempFolderToArchive(arch_file, name);
 }
 
 bool ProjectFile::DeleteTempFolder()
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "project/atProjectIndex.hpp"
+#include "project/atProjectFile.hpp"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace at {
+namespace {
+	int CountWidgets(const std::string& layout)
+	{
+		int count = 0;
+		std::size_t pos = layout.find("<Widget");
+
+		while (pos != std::string::npos) {
+			const char c = pos + 7 < layout.size() ? layout[pos + 7] : 0;
+
+			if (c == ' ' || c == '>' || c == '\t' || c == '\n') {
+				count++;
+			}
+
+			pos = layout.find("<Widget", pos + 7);
+		}
+
+		return count;
+	}
+
+	std::string GetLayoutScriptPath(const std::string& layout)
+	{
+		const std::size_t pos = layout.find("script=\"");
+
+		if (pos == std::string::npos) {
+			return "";
+		}
+
+		const std::size_t end = layout.find('"', pos + 8);
+
+		if (end == std::string::npos) {
+			return "";
+		}
+
+		return layout.substr(pos + 8, end - pos - 8);
+	}
+}
+
+std::unique_ptr<ProjectIndex> ProjectIndex::_instance = nullptr;
+
+ProjectIndex* ProjectIndex::GetInstance()
+{
+	if (_instance == nullptr) {
+		_instance.reset(new ProjectIndex());
+	}
+
+	return _instance.get();
+}
+
+ProjectIndex::ProjectIndex()
+	: ax::event::Object(ax::App::GetInstance().GetEventManager())
+	, _index_path("project.index")
+	, _is_refreshing(false)
+	, _refresh_again(false)
+	, _next_listener_id(0)
+{
+	_directories.push_back(std::pair<std::string, std::string>("layouts/", "xml"));
+	Load();
+
+	AddConnection(INDEX_UPDATED, ax::event::Function([this](ax::event::Msg* msg) { OnIndexUpdated(msg); }));
+}
+
+ProjectIndex::~ProjectIndex()
+{
+	if (_refresh_thread.joinable()) {
+		_refresh_thread.join();
+	}
+}
+
+void ProjectIndex::AddDirectory(const std::string& dir_path, const std::string& extension)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	const std::pair<std::string, std::string> dir(dir_path, extension);
+
+	if (std::find(_directories.begin(), _directories.end(), dir) == _directories.end()) {
+		_directories.push_back(dir);
+	}
+}
+
+void ProjectIndex::AddFile(const std::string& path)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (std::find(_files.begin(), _files.end(), path) != _files.end()) {
+			return;
+		}
+
+		_files.push_back(path);
+	}
+
+	Refresh();
+}
+
+void ProjectIndex::Refresh()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Files may have changed after the running refresh listed them.
+		if (_is_refreshing) {
+			_refresh_again = true;
+			return;
+		}
+
+		_is_refreshing = true;
+	}
+
+	if (_refresh_thread.joinable()) {
+		_refresh_thread.join();
+	}
+
+	_refresh_thread = std::thread([this]() { RefreshThread(); });
+}
+
+int ProjectIndex::AddUpdateListener(UpdateListener listener)
+{
+	const int id = _next_listener_id++;
+	_update_listeners[id] = listener;
+	return id;
+}
+
+void ProjectIndex::RemoveUpdateListener(int id)
+{
+	_update_listeners.erase(id);
+}
+
+std::vector<ProjectIndex::Entry> ProjectIndex::GetEntries(const std::string& extension) const
+{
+	std::vector<Entry> entries;
+	const std::string ext("." + extension);
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (auto& n : _entries) {
+			if (boost::filesystem::path(n.first).extension().string() == ext) {
+				entries.push_back(n.second);
+			}
+		}
+	}
+
+	std::sort(entries.begin(), entries.end(),
+		[](const Entry& a, const Entry& b) { return a.mtime > b.mtime; });
+	return entries;
+}
+
+void ProjectIndex::RefreshThread()
+{
+	while (true) {
+		RefreshEntries();
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (!_refresh_again) {
+			_is_refreshing = false;
+			return;
+		}
+
+		_refresh_again = false;
+	}
+}
+
+void ProjectIndex::RefreshEntries()
+{
+	std::vector<std::pair<std::string, std::string>> directories;
+	std::vector<std::string> paths;
+	std::map<std::string, Entry> old_entries;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		directories = _directories;
+		paths = _files;
+		old_entries = _entries;
+	}
+
+	for (auto& dir : directories) {
+		boost::system::error_code err;
+		boost::filesystem::directory_iterator it(dir.first, err), end;
+
+		for (; !err && it != end; it.increment(err)) {
+			const boost::filesystem::path& p = it->path();
+
+			if (p.extension().string() == "." + dir.second) {
+				paths.push_back(p.string());
+			}
+		}
+	}
+
+	std::map<std::string, Entry> entries;
+	bool changed = false;
+
+	for (auto& path : paths) {
+		boost::system::error_code err;
+		const std::time_t mtime = boost::filesystem::last_write_time(path, err);
+
+		// Removed file.
+		if (err) {
+			continue;
+		}
+
+		auto it = old_entries.find(path);
+
+		if (it != old_entries.end() && it->second.mtime == mtime) {
+			entries[path] = it->second;
+			continue;
+		}
+
+		entries[path] = ReadEntry(path, mtime);
+		changed = true;
+	}
+
+	changed = changed || entries.size() != old_entries.size();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_entries = entries;
+	}
+
+	if (changed && !Save()) {
+		ax::console::Error("Can't save project index", _index_path);
+	}
+
+	PushEvent(INDEX_UPDATED, new ax::event::SimpleMsg<int>((int)entries.size()));
+}
+
+void ProjectIndex::OnIndexUpdated(ax::event::Msg* msg)
+{
+	// Listeners can be removed while being called, only call the ones still registered.
+	std::vector<int> ids;
+
+	for (auto& n : _update_listeners) {
+		ids.push_back(n.first);
+	}
+
+	for (auto& id : ids) {
+		auto it = _update_listeners.find(id);
+
+		if (it != _update_listeners.end()) {
+			UpdateListener listener(it->second);
+			listener();
+		}
+	}
+}
+
+ProjectIndex::Entry ProjectIndex::ReadEntry(const std::string& path, std::time_t mtime)
+{
+	const boost::filesystem::path f_path(path);
+
+	Entry entry;
+	entry.name = f_path.stem().string();
+	entry.path = path;
+	entry.mtime = mtime;
+	entry.widget_count = 0;
+	entry.script_size = 0;
+
+	boost::filesystem::path thumbnail(f_path);
+	thumbnail.replace_extension(".png");
+
+	if (boost::filesystem::exists(thumbnail)) {
+		entry.thumbnail = thumbnail.string();
+	}
+
+	if (f_path.extension() == ".atproj") {
+		ProjectFile project(path);
+
+		if (project.IsValid()) {
+			entry.widget_count = CountWidgets(project.GetLayoutContent());
+			entry.script_size = project.GetScriptContent().size();
+		}
+
+		return entry;
+	}
+
+	std::ifstream file(path, std::ios::binary);
+	const std::string layout((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	entry.widget_count = CountWidgets(layout);
+
+	const std::string script_path = GetLayoutScriptPath(layout);
+	boost::system::error_code err;
+
+	if (!script_path.empty()) {
+		const std::uintmax_t size = boost::filesystem::file_size(script_path, err);
+		entry.script_size = err ? 0 : (std::size_t)size;
+	}
+
+	return entry;
+}
+
+bool ProjectIndex::Load()
+{
+	std::ifstream file(_index_path);
+
+	if (!file.is_open()) {
+		return false;
+	}
+
+	std::string line;
+
+	// One tab separated entry per line : path, mtime, name, widget count, script size, thumbnail.
+	while (std::getline(file, line)) {
+		std::vector<std::string> values;
+		std::istringstream stream(line);
+		std::string value;
+
+		while (std::getline(stream, value, '\t')) {
+			values.push_back(value);
+		}
+
+		if (values.size() < 5) {
+			continue;
+		}
+
+		Entry entry;
+		entry.path = values[0];
+		entry.name = values[2];
+		entry.thumbnail = values.size() > 5 ? values[5] : "";
+
+		try {
+			entry.mtime = (std::time_t)std::stoll(values[1]);
+			entry.widget_count = std::stoi(values[3]);
+			entry.script_size = (std::size_t)std::stoull(values[4]);
+		}
+		catch (std::exception& err) {
+			continue;
+		}
+
+		_entries[entry.path] = entry;
+
+		// Keep indexing files outside of directories.
+		if (boost::filesystem::path(entry.path).extension() == ".atproj") {
+			_files.push_back(entry.path);
+		}
+	}
+
+	return true;
+}
+
+bool ProjectIndex::Save() const
+{
+	std::ofstream file(_index_path, std::ios::trunc);
+
+	if (!file.is_open()) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (auto& n : _entries) {
+		const Entry& e = n.second;
+		file << e.path << '\t' << (long long)e.mtime << '\t' << e.name << '\t' << e.widget_count << '\t'
+			 << e.script_size << '\t' << e.thumbnail << '\n';
+	}
+
+	return file.good();
+}
+}
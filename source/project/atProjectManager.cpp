@@ -59,7 +59,10 @@ bool ProjectManager::Open(const std::string& path)
 		return -1;
 	}
 
-	_p_file->ExtractArchive("tmp/");
+	if (!_p_file->ExtractArchive("tmp/")) {
+		ax::console::Error("Can't extract project", path);
+		return false;
+	}
 
 	return true;
 }
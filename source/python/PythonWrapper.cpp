@@ -30,6 +30,7 @@
 #include "python/KnobPyWrapper.hpp"
 #include "python/NumberBoxPyWrapper.hpp"
 #include "python/PanelPyWrapper.hpp"
+#include "python/SamplePyWrapper.hpp"
 #include "python/SpritePyWrapper.hpp"
 #include "python/WindowPyWrapper.hpp"
 
@@ -96,6 +97,9 @@ BOOST_PYTHON_MODULE(ax)
 
 	ax::python::export_python_wrapper_knob();
 
+	// Cached samples.
+	ax::python::export_python_wrapper_sample();
+
 	boost::python::class_<ax::python::Widgets>("Widgets").def("Get", &ax::python::Widgets::Get);
 
 	//
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2016 AudioTools - All Rights Reserved
+ *
+ * This Software may not be distributed in parts or its entirety
+ * without prior written agreement by AudioTools.
+ *
+ * Neither the name of the AudioTools nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AUDIOTOOLS "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL AUDIOTOOLS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Written by Alexandre Arsenault <alx.arsenault@gmail.com>
+ */
+
+#include "python/SamplePyWrapper.hpp"
+#include <Python/Python.h>
+#include <boost/python.hpp>
+#include <cstdio>
+#include <cstring>
+
+using namespace boost::python;
+
+namespace ax {
+namespace python {
+
+	Sample::Sample(at::SampleCache::Ptr sample)
+		: _sample(sample)
+		, _buffer_shape(0)
+		, _buffer_stride(sizeof(float))
+	{
+	}
+
+	bool Sample::IsValid() const
+	{
+		return _sample != nullptr;
+	}
+
+	int Sample::GetChannels() const
+	{
+		return _sample ? _sample->channels : 0;
+	}
+
+	int Sample::GetSampleRate() const
+	{
+		return _sample ? _sample->sample_rate : 0;
+	}
+
+	int Sample::GetFrames() const
+	{
+		return _sample ? (int)_sample->frames : 0;
+	}
+
+	std::string Sample::GetHash() const
+	{
+		return _sample ? _sample->hash : "";
+	}
+
+	float Sample::GetValue(int frame, int channel) const
+	{
+		if (!_sample || frame < 0 || channel < 0 || frame >= (int)_sample->frames
+			|| channel >= _sample->channels) {
+			return 0.0f;
+		}
+
+		return _sample->data[frame * _sample->channels + channel];
+	}
+
+	boost::python::object Sample::GetBuffer(boost::python::object self)
+	{
+		Sample& sample = extract<Sample&>(self);
+
+		if (!sample._sample) {
+			return boost::python::object();
+		}
+
+		const std::vector<float>& data = sample._sample->data;
+		sample._buffer_shape = (Py_ssize_t)data.size();
+
+		// PyBuffer_FillInfo only exports unsigned bytes, float items are described by hand.
+		// The buffer holds a reference to self, which holds the cached sample and the shape.
+		Py_buffer view;
+		std::memset(&view, 0, sizeof(Py_buffer));
+		view.buf = (void*)data.data();
+		view.obj = self.ptr();
+		view.len = (Py_ssize_t)(data.size() * sizeof(float));
+		view.readonly = 1;
+		view.itemsize = sizeof(float);
+		view.format = (char*)"f";
+		view.ndim = 1;
+		view.shape = &sample._buffer_shape;
+		view.strides = &sample._buffer_stride;
+		Py_INCREF(view.obj);
+
+		return boost::python::object(handle<>(PyMemoryView_FromBuffer(&view)));
+	}
+
+	Sample LoadSample(const std::string& path)
+	{
+		return Sample(at::SampleCache::GetInstance()->Load(path));
+	}
+
+	void export_python_wrapper_sample()
+	{
+		class_<ax::python::Sample>("Sample", no_init)
+			.def("IsValid", &ax::python::Sample::IsValid)
+			.def("GetChannels", &ax::python::Sample::GetChannels)
+			.def("GetSampleRate", &ax::python::Sample::GetSampleRate)
+			.def("GetFrames", &ax::python::Sample::GetFrames)
+			.def("GetHash", &ax::python::Sample::GetHash)
+			.def("GetValue", &ax::python::Sample::GetValue)
+			.def("GetBuffer", &ax::python::Sample::GetBuffer);
+
+		def("LoadSample", ax::python::LoadSample, arg("path"));
+	}
+}
+}
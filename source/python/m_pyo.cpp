@@ -137,6 +137,54 @@ int pyo_exec_statement(PyThreadState* interp, char* msg, int debug)
 	return err;
 }
 
+bool pyo_compile_check(PyThreadState* interp, const std::string& code, int& line, std::string& msg)
+{
+	line = 0;
+	msg.clear();
+
+	PyEval_AcquireThread(interp);
+	PyObject* code_obj = Py_CompileString(code.c_str(), "script", Py_file_input);
+
+	if (code_obj != nullptr) {
+		Py_DECREF(code_obj);
+		PyEval_ReleaseThread(interp);
+		return true;
+	}
+
+	PyObject *exc, *val, *tb;
+	PyErr_Fetch(&exc, &val, &tb);
+	PyErr_NormalizeException(&exc, &val, &tb);
+
+	if (val != nullptr) {
+		// SyntaxError and IndentationError carry the line number and message.
+		PyObject* lineno = PyObject_GetAttrString(val, "lineno");
+		PyObject* err_msg = PyObject_GetAttrString(val, "msg");
+
+		if (lineno != nullptr && PyInt_Check(lineno)) {
+			line = (int)PyInt_AsLong(lineno);
+		}
+
+		if (err_msg != nullptr && PyString_Check(err_msg)) {
+			msg = PyString_AsString(err_msg);
+		}
+
+		Py_XDECREF(lineno);
+		Py_XDECREF(err_msg);
+	}
+
+	if (msg.empty() && exc != nullptr) {
+		msg = ((PyTypeObject*)exc)->tp_name;
+	}
+
+	Py_XDECREF(exc);
+	Py_XDECREF(val);
+	Py_XDECREF(tb);
+	PyErr_Clear();
+
+	PyEval_ReleaseThread(interp);
+	return false;
+}
+
 std::string pyo_GetClassBriefDoc(PyThreadState* interp, const std::string& class_name)
 {
 	std::string output;